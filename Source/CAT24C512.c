@@ -94,7 +94,7 @@ bool CAT24C512_writePage( uint16 stPageAddr, uint8 stByteAddr, uint8 *pDataBytes
     return FALSE;
   
   // Check for unsupported params, abort if necessary
-  if( ( numBytes > 128 ) || ( stPageAddr > CAT24C512_LAST_PAGE_ADDR ) || ( stByteAddr > CAT24C512_LAST_BYTE_ADDR ) )
+  if( ( numBytes > CAT24C512.buffSize ) || ( stPageAddr > CAT24C512_LAST_PAGE_ADDR ) || ( stByteAddr > CAT24C512_LAST_BYTE_ADDR ) )
     return FALSE;
   
   /*
@@ -180,6 +180,73 @@ bool CAT24C512_sequentialRead( uint16 stPageAddr, uint8 stByteAddr, uint8 *pByte
   
 } // CAT24C512_sequentialRead
 
+// Blocks until the EEPROM ACKs its address again, i.e. the internal write cycle
+// of the last page/byte write is complete.
+// Returns FALSE if the device did not respond within CAT24C512_WRITE_POLL_MAX polls.
+bool CAT24C512_waitWriteCycle( void )
+{
+  for( uint8 i = 0; i < CAT24C512_WRITE_POLL_MAX; i++ )
+  {
+    if( mujoeI2C_ackPoll( CAT24C512.i2cWriteAddr ) )
+      return TRUE;
+  }
+  
+  return FALSE;
+  
+} // CAT24C512_waitWriteCycle
+
+// Writes "len" bytes of pData as a CRC protected record at the start of page "pageAddr".
+// "key" identifies the record owner so a stale record of another kind is never accepted.
+// Blocks until the write cycle completes. Returns FALSE if the record does not fit
+// the buffer given to CAT24C512_initDriver.
+bool CAT24C512_writeRecord( uint16 pageAddr, uint8 key, uint8 *pData, uint8 len )
+{
+  if( ( len > CAT24C512_RECORD_MAX_DATA_LEN ) || ( len + CAT24C512_RECORD_OVERHEAD > CAT24C512.buffSize ) )
+    return FALSE;
+  
+  uint8 *pRec = (uint8 *)osal_mem_alloc( len + CAT24C512_RECORD_OVERHEAD );
+  if( pRec == NULL )
+    return FALSE;
+  
+  // Build record
+  pRec[0] = key;
+  pRec[1] = len;
+  VOID memcpy( pRec + 2, pData, len );
+  pRec[len + 2] = mujoeToolBox_crc8( 0x00, pRec, len + 2 );
+  
+  bool stat = CAT24C512_writePage( pageAddr, 0, pRec, len + CAT24C512_RECORD_OVERHEAD );
+  osal_mem_free( pRec );
+  
+  return stat ? CAT24C512_waitWriteCycle() : FALSE;
+  
+} // CAT24C512_writeRecord
+
+// Reads the record at the start of page "pageAddr" into pData.
+// Returns FALSE if the key or length do not match or the CRC check fails.
+bool CAT24C512_readRecord( uint16 pageAddr, uint8 key, uint8 *pData, uint8 len )
+{
+  uint8 hdr[2];
+  uint8 crc;
+  
+  if( len > CAT24C512_RECORD_MAX_DATA_LEN )
+    return FALSE;
+  
+  // Check the header before pulling in the payload
+  if( !CAT24C512_sequentialRead( pageAddr, 0, hdr, 2 ) )
+    return FALSE;
+  if( ( hdr[0] != key ) || ( hdr[1] != len ) )
+    return FALSE;
+  
+  // Read payload and CRC, then validate
+  if( !CAT24C512_sequentialRead( pageAddr, 2, pData, len ) )
+    return FALSE;
+  if( !CAT24C512_selectiveRead( pageAddr, len + 2, &crc ) )
+    return FALSE;
+  
+  return ( mujoeToolBox_crc8( mujoeToolBox_crc8( 0x00, hdr, 2 ), pData, len ) == crc ) ? TRUE : FALSE;
+  
+} // CAT24C512_readRecord
+
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
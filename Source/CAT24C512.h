@@ -14,6 +14,7 @@
 #include "mujoeI2C.h"
 #include "OSAL_Memory.h"        // for osal_mem_alloc
 #include "string.h"             // for memcpy
+#include "mujoeToolBox.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // DEFINES
@@ -25,6 +26,23 @@
 #define CAT24C512_FIRST_BYTE_ADDR       0
 #define CAT24C512_LAST_BYTE_ADDR        127
 
+#define CAT24C512_PAGE_SIZE             128
+
+// TX/RX buffer size the board passes to CAT24C512_initDriver. Bounds every page
+// write, records included.
+#define CAT24C512_BUFF_SIZE             64
+
+// Record framing: [key][len][data ...][crc8]. A record is written in one page
+// write, so it must fit the driver buffer as well as one page.
+#define CAT24C512_RECORD_OVERHEAD       3
+#define CAT24C512_RECORD_MAX_DATA_LEN   ( CAT24C512_BUFF_SIZE - CAT24C512_RECORD_OVERHEAD )
+
+// Max number of ACK polls to wait out an internal write cycle (~40 us each, tWR = 5 ms)
+#define CAT24C512_WRITE_POLL_MAX        250
+
+// Internal write cycle time, tWR (ms)
+#define CAT24C512_WRITE_CYCLE_TIME      5
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
@@ -55,5 +73,8 @@ bool CAT24C512_writeByte( uint16 pageAddr, uint8 byteAddr, uint8 byteData );
 bool CAT24C512_writePage( uint16 stPageAddr, uint8 stByteAddr, uint8 *pDataBytes, uint8 numBytes );
 bool CAT24C512_selectiveRead( uint16 pageAddr, uint8 byteAddr, uint8 *pByteData );
 bool CAT24C512_sequentialRead( uint16 stPageAddr, uint8 stByteAddr, uint8 *pByteData, uint8 numBytes );
+bool CAT24C512_waitWriteCycle( void );
+bool CAT24C512_writeRecord( uint16 pageAddr, uint8 key, uint8 *pData, uint8 len );
+bool CAT24C512_readRecord( uint16 pageAddr, uint8 key, uint8 *pData, uint8 len );
 
 #endif // CAT24C512_H
\ No newline at end of file
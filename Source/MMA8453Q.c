@@ -17,6 +17,7 @@ static MMA845xQ_t      MMA845xQ =
 {
   .i2cWriteAddr = 0x00,
   .buffSize = 0,
+  .fRead = FALSE,
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -127,6 +128,79 @@ bool MMA8453Q_bulkWrite( mma845xq_regAddr_t stAddr, uint8 *pData, uint8 numBytes
 
 }// MMA8453Q_bulkWrite
 
+// Sets or clears the ACTIVE bit, leaving the rest of CTRL_REG1 untouched
+bool MMA8453Q_setActive( bool active )
+{
+  uint8 ctrlReg1;
+  if( !MMA8453Q_readReg( MMA_REG_CTRL_REG1, &ctrlReg1 ) )
+    return FALSE;
+  
+  if( active )
+    ctrlReg1 |= MMA_CTRL_REG1_ACTIVE;
+  else
+    ctrlReg1 &= ~MMA_CTRL_REG1_ACTIVE;
+  
+  return MMA8453Q_writeReg( MMA_REG_CTRL_REG1, ctrlReg1 );
+  
+} // MMA8453Q_setActive
+
+// fRead = TRUE selects 8-bit samples so an XYZ burst is 4 bytes instead of 7.
+// CTRL_REG1 can only be changed in STANDBY, so the part is dropped to STANDBY
+// and then restored to its previous mode.
+bool MMA8453Q_setFastRead( bool fRead )
+{
+  uint8 ctrlReg1;
+  if( !MMA8453Q_readReg( MMA_REG_CTRL_REG1, &ctrlReg1 ) )
+    return FALSE;
+  
+  if( ctrlReg1 & MMA_CTRL_REG1_ACTIVE )
+  {
+    if( !MMA8453Q_writeReg( MMA_REG_CTRL_REG1, ctrlReg1 & ~MMA_CTRL_REG1_ACTIVE ) )
+      return FALSE;
+  }
+  
+  if( fRead )
+    ctrlReg1 |= MMA_CTRL_REG1_F_READ;
+  else
+    ctrlReg1 &= ~MMA_CTRL_REG1_F_READ;
+  
+  if( !MMA8453Q_writeReg( MMA_REG_CTRL_REG1, ctrlReg1 ) )
+    return FALSE;
+  
+  MMA845xQ.fRead = fRead;
+  return TRUE;
+  
+} // MMA8453Q_setFastRead
+
+// Reads STATUS and all three axes in a single burst. Samples are returned as
+// signed 10-bit counts in either mode; in F_READ mode the 2 LSBs are zero.
+bool MMA8453Q_readXYZ( int16 *pXYZ, uint8 *pStatus )
+{
+  uint8 rxBuff[MMA_XYZ_BURST_LEN];
+  
+  if( MMA845xQ.fRead )
+  {
+    if( !MMA8453Q_bulkRead( MMA_REG_STATUS, rxBuff, MMA_XYZ_FREAD_BURST_LEN ) )
+      return FALSE;
+    
+    for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+      pXYZ[i] = (int16)( (int8)rxBuff[1 + i] ) * 4;
+  }
+  else
+  {
+    if( !MMA8453Q_bulkRead( MMA_REG_STATUS, rxBuff, MMA_XYZ_BURST_LEN ) )
+      return FALSE;
+    
+    // Data is left justified, MSB holds bits 9:2 and LSB bits 1:0 in its top 2 bits
+    for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+      pXYZ[i] = ( (int16)( ( ( (uint16)rxBuff[1 + 2*i] ) << 8 ) + rxBuff[2 + 2*i] ) ) >> 6;
+  }
+  
+  *pStatus = rxBuff[0];
+  return TRUE;
+  
+} // MMA8453Q_readXYZ
+
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
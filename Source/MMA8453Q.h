@@ -25,6 +25,66 @@
 // Who Am I ID
 #define MMA845xQ_WHO_AM_I_ID                0x3A
 
+// STATUS Register Bits
+#define MMA_STATUS_ZYXDR                    0x08 // New X, Y and Z data ready
+#define MMA_STATUS_ZYXOW                    0x80 // X, Y or Z data overwritten before read
+
+// CTRL_REG1 Register Bits
+#define MMA_CTRL_REG1_ACTIVE                0x01
+#define MMA_CTRL_REG1_F_READ                0x02 // 8-bit fast read, auto-increment skips LSBs
+#define MMA_CTRL_REG1_ODR_MASK              0x38
+
+// CTRL_REG2 Register Bits
+#define MMA_CTRL_REG2_SLPE                  0x04 // Auto-sleep enable
+
+// CTRL_REG3 Register Bits
+#define MMA_CTRL_REG3_WAKE_FF_MT            0x08 // Freefall/motion detection wakes the part from auto-sleep
+#define MMA_CTRL_REG3_WAKE_TRANS            0x40 // Transient detection wakes the part from auto-sleep
+
+// CTRL_REG4 / CTRL_REG5 Register Bits, shared with INT_SOURCE
+#define MMA_CTRL_REG4_INT_EN_DRDY           0x01 // Data ready interrupt enable
+#define MMA_CTRL_REG4_INT_EN_FF_MT          0x04 // Freefall/motion interrupt enable
+#define MMA_CTRL_REG4_INT_EN_TRANS          0x20 // Transient interrupt enable
+#define MMA_CTRL_REG4_INT_EN_ASLP           0x80 // Auto-sleep/wake interrupt enable
+#define MMA_CTRL_REG5_INT_CFG_DRDY          0x01 // Route data ready interrupt to INT1 (INT2 if clear)
+
+// INT_SOURCE Register Bits
+#define MMA_INT_SOURCE_SRC_DRDY             0x01
+#define MMA_INT_SOURCE_SRC_FF_MT            0x04
+#define MMA_INT_SOURCE_SRC_TRANS            0x20
+#define MMA_INT_SOURCE_SRC_ASLP             0x80
+
+// SYSMOD Register Values
+#define MMA_SYSMOD_STANDBY                  0x00
+#define MMA_SYSMOD_WAKE                     0x01
+#define MMA_SYSMOD_SLEEP                    0x02
+
+// FF_MT_CFG Register Bits
+#define MMA_FF_MT_CFG_XEFE                  0x08 // X event flag enable
+#define MMA_FF_MT_CFG_YEFE                  0x10
+#define MMA_FF_MT_CFG_ZEFE                  0x20
+#define MMA_FF_MT_CFG_OAE                   0x40 // Motion (OR of axes above THS), freefall (AND below THS) if clear
+#define MMA_FF_MT_CFG_ELE                   0x80 // Latch event flags in FF_MT_SRC until read
+
+// FF_MT_THS Register Bits
+#define MMA_FF_MT_THS_DBCNTM                0x80 // Debounce counter cleared, not decremented, when the condition drops
+
+// FF_MT_SRC Register Bits
+#define MMA_FF_MT_SRC_EA                    0x80 // Event active
+
+// TRANSIENT_CFG Register Bits
+#define MMA_TRANSIENT_CFG_XTEFE             0x02 // X transient event flag enable
+#define MMA_TRANSIENT_CFG_YTEFE             0x04
+#define MMA_TRANSIENT_CFG_ZTEFE             0x08
+#define MMA_TRANSIENT_CFG_ELE               0x10 // Latch event flags in TRANSIENT_SRC until read
+
+// XYZ burst lengths, STATUS thru OUT_Z_LSB (10-bit) or STATUS thru OUT_Z_MSB (F_READ)
+#define MMA_XYZ_BURST_LEN                   7
+#define MMA_XYZ_FREAD_BURST_LEN             4
+
+// Number of axes in an XYZ sample
+#define MMA_NUM_AXES                        3
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
@@ -121,11 +181,21 @@ typedef enum
   
 }mma845xq_slpPwrSch_t;
 
+// Dynamic Range, 10-bit sensitivity is 256 counts/g at 2g and halves per step
+typedef enum
+{
+  MMA_FS_2G             = 0x00,
+  MMA_FS_4G             = 0x01,
+  MMA_FS_8G             = 0x02,
+  
+}mma845xq_fullScale_t;
+
 typedef struct MMA845xQ_def
 {
   uint8         i2cWriteAddr;
   uint8         *pBuff;
   uint8         buffSize;
+  bool          fRead;          // TRUE if F_READ 8-bit mode is set
   
 }MMA845xQ_t;
 
@@ -138,5 +208,9 @@ bool MMA845Q_initHardware( void );
 bool MMA8453Q_readReg( mma845xq_regAddr_t addr, uint8 *pData );
 bool MMA8453Q_bulkRead( mma845xq_regAddr_t stAddr, uint8 *pData, uint8 numBytes );
 bool MMA8453Q_writeReg( mma845xq_regAddr_t addr, uint8 data );
+bool MMA8453Q_bulkWrite( mma845xq_regAddr_t stAddr, uint8 *pData, uint8 numBytes );
+bool MMA8453Q_setActive( bool active );
+bool MMA8453Q_setFastRead( bool fRead );
+bool MMA8453Q_readXYZ( int16 *pXYZ, uint8 *pStatus );
 
 #endif // MMA8453Q_H
\ No newline at end of file
@@ -13,17 +13,523 @@
 // LOCAL VAR
 ////////////////////////////////////////////////////////////////////////////////
 
+static MMA8453QMGR_t    MMA8453QMgr = 
+{
+  .sysOdr = MMA_SYSODR_100HZ,
+  .slpOdr = MMA_SLPODR_12HZ5,
+  .actPwrSch = MMA_MODS_LNLP,
+  .slpPwrSch = MMA_SMODS_LP,
+  .fullScale = MMA_FS_2G,
+  .profile = MMAMGR_PROFILE_FLIGHT,
+  .highRate = FALSE,
+  .sleeping = FALSE,
+  .offset = { 0, 0, 0 },
+  .calibrating = FALSE,
+  .gravInit = FALSE,
+};
+
+static MMA8453QMGRFIFO_t        MMA8453QMgrFifo = 
+{
+  .head = 0,
+  .tail = 0,
+  .overrunCnt = 0,
+};
+
+// Configuration profile register images, indexed by mma8453qMgr_profileId_t
+static const mma8453qMgrProfile_t MMA8453QMgr_profileTbl[MMAMGR_NUM_PROFILES] = 
+{
+  // MMAMGR_PROFILE_IDLE
+  {
+    .dataCfg = { MMA_FS_2G, 0x00 },
+    .ffmt = { 0x00, 0x00, 0x00, 0x00 },
+    .transient = { 0x00, 0x00, 0x00, 0x00 },
+    .ctrl = 
+    {
+      0x00,
+      MMA_SLPODR_1HZ56 | MMA_SYSODR_12HZ5,
+      MMA_SMODS_LP | MMA_MODS_LP,
+      0x00,
+      MMA_CTRL_REG4_INT_EN_DRDY,
+      MMA_CTRL_REG5_INT_CFG_DRDY,
+    },
+  },
+  // MMAMGR_PROFILE_FLIGHT
+  {
+    .dataCfg = { MMA_FS_2G, 0x00 },
+    .ffmt = 
+    { 
+      MMA_FF_MT_CFG_ELE | MMA_FF_MT_CFG_OAE | MMA_FF_MT_CFG_ZEFE | MMA_FF_MT_CFG_YEFE | MMA_FF_MT_CFG_XEFE,
+      0x00,
+      MMAMGR_IMPACT_THS,
+      MMAMGR_IMPACT_COUNT,
+    },
+    .transient = 
+    { 
+      MMA_TRANSIENT_CFG_ELE | MMA_TRANSIENT_CFG_ZTEFE | MMA_TRANSIENT_CFG_YTEFE | MMA_TRANSIENT_CFG_XTEFE,
+      0x00,
+      MMAMGR_TRANSIENT_THS,
+      MMAMGR_TRANSIENT_COUNT,
+    },
+    .ctrl = 
+    {
+      MMAMGR_ASLP_COUNT,
+      MMA_SLPODR_12HZ5 | MMA_SYSODR_100HZ,
+      MMA_CTRL_REG2_SLPE | MMA_SMODS_LP | MMA_MODS_LNLP,
+      MMA_CTRL_REG3_WAKE_TRANS | MMA_CTRL_REG3_WAKE_FF_MT,
+      MMA_CTRL_REG4_INT_EN_DRDY | MMA_CTRL_REG4_INT_EN_FF_MT | MMA_CTRL_REG4_INT_EN_TRANS | MMA_CTRL_REG4_INT_EN_ASLP,
+      MMA_CTRL_REG5_INT_CFG_DRDY,
+    },
+  },
+  // MMAMGR_PROFILE_VIBRATION
+  {
+    .dataCfg = { MMA_FS_2G, 0x00 },
+    .ffmt = 
+    { 
+      MMA_FF_MT_CFG_ELE | MMA_FF_MT_CFG_OAE | MMA_FF_MT_CFG_ZEFE | MMA_FF_MT_CFG_YEFE | MMA_FF_MT_CFG_XEFE,
+      0x00,
+      MMAMGR_IMPACT_THS,
+      MMAMGR_IMPACT_COUNT_800HZ,
+    },
+    .transient = { 0x00, 0x00, 0x00, 0x00 },
+    .ctrl = 
+    {
+      0x00,
+      MMA_SLPODR_12HZ5 | MMA_SYSODR_800HZ,
+      MMA_SMODS_NRML | MMA_MODS_NRML,
+      0x00,
+      MMA_CTRL_REG4_INT_EN_DRDY | MMA_CTRL_REG4_INT_EN_FF_MT,
+      MMA_CTRL_REG5_INT_CFG_DRDY,
+    },
+  },
+  // MMAMGR_PROFILE_MOTION_WAKE
+  {
+    .dataCfg = { MMA_FS_2G, 0x00 },
+    .ffmt = { 0x00, 0x00, 0x00, 0x00 },
+    .transient = 
+    { 
+      MMA_TRANSIENT_CFG_ELE | MMA_TRANSIENT_CFG_ZTEFE | MMA_TRANSIENT_CFG_YTEFE | MMA_TRANSIENT_CFG_XTEFE,
+      0x00,
+      MMAMGR_TRANSIENT_THS,
+      1,
+    },
+    .ctrl = 
+    {
+      0x00,
+      MMA_SLPODR_1HZ56 | MMA_SYSODR_12HZ5,
+      MMA_SMODS_LP | MMA_MODS_LP,
+      0x00,
+      MMA_CTRL_REG4_INT_EN_TRANS,
+      0x00,                     // Transient routed to INT2
+    },
+  },
+};
+
+// Sample period (ms) per System Output Data Rate, indexed by DR bits
+static const uint16 MMA8453QMgr_odrPeriodTbl[] = 
+{
+  2,            // 800 Hz, 1.25 ms rounded up
+  3,            // 400 Hz, 2.5 ms rounded up
+  5,            // 200 Hz
+  10,           // 100 Hz
+  20,           // 50 Hz
+  80,           // 12.5 Hz
+  160,          // 6.25 Hz
+  640,          // 1.56 Hz
+};
+
+// Sample period (ms) per Sleep Mode Output Data Rate, indexed by ASLP_RATE bits
+static const uint16 MMA8453QMgr_slpOdrPeriodTbl[] = 
+{
+  20,           // 50 Hz
+  80,           // 12.5 Hz
+  160,          // 6.25 Hz
+  640,          // 1.56 Hz
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // LOCAL FUNCTION PROTOS
 ////////////////////////////////////////////////////////////////////////////////
 
+static void MMA8453QMgr_fifoOverrun( void );
+static bool MMA8453QMgr_writeOffsets( void );
+static bool MMA8453QMgr_writeProfile( mma8453qMgr_profileId_t profile );
+
 ////////////////////////////////////////////////////////////////////////////////
 // API FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
 
+// Verifies the part and applies the selected profile, leaving it ACTIVE
+bool MMA8453QMgr_initHardware( void )
+{
+  if( !MMA845Q_initHardware() )
+    return FALSE;
+  
+  return MMA8453QMgr_writeProfile( MMA8453QMgr.profile );
+  
+} // MMA8453QMgr_initHardware
+
+// Selects and applies a configuration profile. While a high rate capture is
+// running the profile is only recorded and applied when the capture ends.
+bool MMA8453QMgr_applyProfile( mma8453qMgr_profileId_t profile )
+{
+  if( profile >= MMAMGR_NUM_PROFILES )
+    return FALSE;
+  
+  MMA8453QMgr.profile = profile;
+  if( MMA8453QMgr.highRate )
+    return TRUE;
+  
+  return MMA8453QMgr_writeProfile( profile );
+  
+} // MMA8453QMgr_applyProfile
+
+mma8453qMgr_profileId_t MMA8453QMgr_getProfile( void )
+{
+  return MMA8453QMgr.profile;
+  
+} // MMA8453QMgr_getProfile
+
+// Sets the OFF_X/Y/Z values written by MMA8453QMgr_initHardware, e.g. restored from EEPROM
+void MMA8453QMgr_setOffsets( int8 *pOffset )
+{
+  VOID memcpy( MMA8453QMgr.offset, pOffset, MMA_NUM_AXES );
+  
+} // MMA8453QMgr_setOffsets
+
+void MMA8453QMgr_getOffsets( int8 *pOffset )
+{
+  VOID memcpy( pOffset, MMA8453QMgr.offset, MMA_NUM_AXES );
+  
+} // MMA8453QMgr_getOffsets
+
+// Starts collecting MMAMGR_CAL_NUM_SAMPLES samples for offset calibration.
+// The unit must be at rest with one axis vertical.
+void MMA8453QMgr_startOffsetCal( void )
+{
+  MMA8453QMgr.calCnt = 0;
+  MMA8453QMgr.calMoved = FALSE;
+  VOID memset( MMA8453QMgr.calSum, 0, sizeof( MMA8453QMgr.calSum ) );
+  MMA8453QMgr.calibrating = TRUE;
+  
+} // MMA8453QMgr_startOffsetCal
+
+bool MMA8453QMgr_isCalibrating( void )
+{
+  return MMA8453QMgr.calibrating;
+  
+} // MMA8453QMgr_isCalibrating
+
+// Adds a raw sample (counts) to the calibration average. Returns TRUE once
+// enough samples are collected and MMA8453QMgr_applyOffsetCal should be called.
+bool MMA8453QMgr_accumOffsetCal( int16 *pXYZ )
+{
+  if( !MMA8453QMgr.calibrating || ( MMA8453QMgr.calCnt >= MMAMGR_CAL_NUM_SAMPLES ) )
+    return FALSE;
+  
+  if( MMA8453QMgr.calCnt == 0 )
+    VOID memcpy( MMA8453QMgr.calFirst, pXYZ, sizeof( MMA8453QMgr.calFirst ) );
+  
+  for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+  {
+    int16 dev = pXYZ[i] - MMA8453QMgr.calFirst[i];
+    if( ( dev > MMAMGR_CAL_MAX_DEV ) || ( dev < -MMAMGR_CAL_MAX_DEV ) )
+      MMA8453QMgr.calMoved = TRUE;
+    MMA8453QMgr.calSum[i] += pXYZ[i];
+  }
+  
+  return ( ++MMA8453QMgr.calCnt == MMAMGR_CAL_NUM_SAMPLES ) ? TRUE : FALSE;
+  
+} // MMA8453QMgr_accumOffsetCal
+
+// Computes OFF_X/Y/Z so the averaged sample reads 0g on the two level axes
+// and +/-1g on the vertical one, and programs them. The hardware then applies
+// the correction to every sample at no CPU cost. Returns FALSE, leaving the
+// offsets unchanged, if the unit moved or the write failed.
+bool MMA8453QMgr_applyOffsetCal( void )
+{
+  MMA8453QMgr.calibrating = FALSE;
+  if( MMA8453QMgr.calMoved || ( MMA8453QMgr.calCnt < MMAMGR_CAL_NUM_SAMPLES ) )
+    return FALSE;
+  
+  int16 countsPerG = MMAMGR_COUNTS_PER_G_2G >> MMA8453QMgr.fullScale;
+  int16 mean[MMA_NUM_AXES];
+  uint8 vert = 0;
+  for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+  {
+    mean[i] = (int16)( MMA8453QMgr.calSum[i] / MMAMGR_CAL_NUM_SAMPLES );
+    if( ( mean[i] < 0 ? -mean[i] : mean[i] ) > ( mean[vert] < 0 ? -mean[vert] : mean[vert] ) )
+      vert = i;
+  }
+  
+  int8 newOffset[MMA_NUM_AXES];
+  for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+  {
+    int16 target = ( i != vert ) ? 0 : ( ( mean[i] < 0 ) ? -countsPerG : countsPerG );
+    
+    // Offset LSB is 2 mg, a count is 2^( fullScale + 1 ) offset LSBs
+    int16 off = MMA8453QMgr.offset[i] + ( ( target - mean[i] ) << ( MMA8453QMgr.fullScale + 1 ) );
+    if( off > 127 ){ off = 127; }
+    if( off < -128 ){ off = -128; }
+    newOffset[i] = (int8)off;
+  }
+  
+  int8 oldOffset[MMA_NUM_AXES];
+  VOID memcpy( oldOffset, MMA8453QMgr.offset, MMA_NUM_AXES );
+  VOID memcpy( MMA8453QMgr.offset, newOffset, MMA_NUM_AXES );
+  if( !MMA8453QMgr_writeOffsets() )
+  {
+    VOID memcpy( MMA8453QMgr.offset, oldOffset, MMA_NUM_AXES );
+    return FALSE;
+  }
+  
+  // Gravity estimate is re-seeded from calibrated samples
+  MMA8453QMgr.gravInit = FALSE;
+  return TRUE;
+  
+} // MMA8453QMgr_applyOffsetCal
+
+// highRate = TRUE switches to MMAMGR_PROFILE_VIBRATION, FALSE restores the selected profile
+bool MMA8453QMgr_setHighRate( bool highRate )
+{
+  if( !MMA8453QMgr_writeProfile( highRate ? MMAMGR_PROFILE_VIBRATION : MMA8453QMgr.profile ) )
+    return FALSE;
+  
+  MMA8453QMgr.highRate = highRate;
+  return TRUE;
+  
+} // MMA8453QMgr_setHighRate
+
+// Returns the accelerometer sample period (ms) at the active ODR
+uint16 MMA8453QMgr_getSamplePeriod( void )
+{
+  if( MMA8453QMgr.sleeping )
+    return MMA8453QMgr_slpOdrPeriodTbl[MMA8453QMgr.slpOdr >> 6];
+  else
+    return MMA8453QMgr_odrPeriodTbl[MMA8453QMgr.sysOdr >> 3];
+  
+} // MMA8453QMgr_getSamplePeriod
+
+// Services INT2: reads INT_SOURCE, clears a latched impact or transient and
+// refreshes the wake/sleep state from SYSMOD. Returns TRUE if the read succeeded.
+bool MMA8453QMgr_updateSysMode( void )
+{
+  uint8 intSrc;
+  if( !MMA8453Q_readReg( MMA_REG_INT_SOURCE, &intSrc ) )
+    return FALSE;
+  
+  uint8 reg;
+  if( intSrc & MMA_INT_SOURCE_SRC_FF_MT )
+  {
+    if( !MMA8453Q_readReg( MMA_REG_FF_MT_SRC, &reg ) )
+      return FALSE;
+    if( reg & MMA_FF_MT_SRC_EA )
+      MMA8453QMgr.impactSrc = reg;
+  }
+
+  if( intSrc & MMA_INT_SOURCE_SRC_TRANS )
+  {
+    if( !MMA8453Q_readReg( MMA_REG_TRANSIENT_SRC, &reg ) )
+      return FALSE;
+  }
+  
+  // Reading SYSMOD also clears SRC_ASLP
+  if( !MMA8453Q_readReg( MMA_REG_SYSMOD, &reg ) )
+    return FALSE;
+  
+  MMA8453QMgr.sleeping = ( ( reg & 0x03 ) == MMA_SYSMOD_SLEEP ) ? TRUE : FALSE;
+  return TRUE;
+  
+} // MMA8453QMgr_updateSysMode
+
+// Returns TRUE while the part is in auto-sleep, i.e. the unit is stationary
+bool MMA8453QMgr_isSleeping( void )
+{
+  return MMA8453QMgr.sleeping;
+  
+} // MMA8453QMgr_isSleeping
+
+// Returns the FF_MT_SRC of an impact seen since the last call, 0 if none
+uint8 MMA8453QMgr_takeImpact( void )
+{
+  uint8 src = MMA8453QMgr.impactSrc;
+  MMA8453QMgr.impactSrc = 0;
+  return src;
+  
+} // MMA8453QMgr_takeImpact
+
+// Returns the gravity estimate (10-bit counts)
+void MMA8453QMgr_getGravity( int16 *pGrav )
+{
+  for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+    pGrav[i] = MMA8453QMgr.grav[i] >> MMAMGR_GRAV_Q;
+  
+} // MMA8453QMgr_getGravity
+
+// Feeds an XYZ sample (10-bit counts). A slow low pass of the accel vector
+// tracks gravity; projecting each sample onto it and removing 1g leaves the
+// vertical acceleration regardless of how the unit is mounted.
+void MMA8453QMgr_processSample( int16 *pXYZ )
+{
+  if( !MMA8453QMgr.gravInit )
+  {
+    for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+      MMA8453QMgr.grav[i] = pXYZ[i] << MMAMGR_GRAV_Q;
+    MMA8453QMgr.gravInit = TRUE;
+  }
+  
+  int32 dot = 0;
+  uint32 gravSq = 0;
+  for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+  {
+    int16 a = pXYZ[i] << MMAMGR_GRAV_Q;
+    MMA8453QMgr.grav[i] += ( a - MMA8453QMgr.grav[i] ) >> MMAMGR_GRAV_LPF_SHIFT;
+    dot += (int32)pXYZ[i] * MMA8453QMgr.grav[i];
+    gravSq += (int32)MMA8453QMgr.grav[i] * MMA8453QMgr.grav[i];
+  }
+  
+  uint16 gravMag = mujoeToolBox_isqrt32( gravSq );
+  if( gravMag == 0 )
+    return;
+  
+  // Vertical accel in counts (Q4): a . g / |g| - |g|
+  int32 vert = ( dot << MMAMGR_GRAV_Q ) / gravMag - gravMag;
+  
+  uint16 countsPerG = MMAMGR_COUNTS_PER_G_2G >> MMA8453QMgr.fullScale;
+  MMA8453QMgr.vertAccel = ( vert * MMAMGR_GRAVITY_MMPS2 ) / ( (int32)countsPerG << MMAMGR_GRAV_Q );
+  
+  // Activity is the EWMA of the squared vertical accel, normalised to 2g counts
+  int32 vert2g = ( vert << MMA8453QMgr.fullScale ) >> MMAMGR_GRAV_Q;
+  uint32 sq = (uint32)( vert2g * vert2g );
+  if( sq > 0xFFFF ){ sq = 0xFFFF; }
+  MMA8453QMgr.activity = MMA8453QMgr.activity - ( MMA8453QMgr.activity >> MMAMGR_ACTIVITY_SHIFT ) + 
+                         ( (uint16)sq >> MMAMGR_ACTIVITY_SHIFT );
+  
+} // MMA8453QMgr_processSample
+
+// Queues a sample read on DRDY. A sample that finds the FIFO full, or a STATUS
+// showing the previous sample was overwritten before it was read, is counted
+// as an overrun.
+void MMA8453QMgr_pushSample( int16 *pXYZ, uint8 status )
+{
+  if( status & MMA_STATUS_ZYXOW )
+    MMA8453QMgr_fifoOverrun();
+  
+  uint8 next = ( MMA8453QMgrFifo.head + 1 ) & ( MMAMGR_FIFO_SIZE - 1 );
+  if( next == MMA8453QMgrFifo.tail )
+  {
+    MMA8453QMgr_fifoOverrun();
+    return;
+  }
+  
+  VOID memcpy( MMA8453QMgrFifo.xyz[MMA8453QMgrFifo.head], pXYZ, sizeof( int16 ) * MMA_NUM_AXES );
+  MMA8453QMgrFifo.head = next;
+  
+} // MMA8453QMgr_pushSample
+
+// Drains the FIFO into "pXYZ" as the average of the queued samples, which
+// decimates high ODRs down to the drain rate. Returns the number of samples drained.
+uint8 MMA8453QMgr_popAverage( int16 *pXYZ )
+{
+  int32 sum[MMA_NUM_AXES] = { 0, 0, 0 };
+  uint8 cnt = 0;
+  
+  while( MMA8453QMgrFifo.tail != MMA8453QMgrFifo.head )
+  {
+    for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+      sum[i] += MMA8453QMgrFifo.xyz[MMA8453QMgrFifo.tail][i];
+    MMA8453QMgrFifo.tail = ( MMA8453QMgrFifo.tail + 1 ) & ( MMAMGR_FIFO_SIZE - 1 );
+    cnt++;
+  }
+  
+  if( cnt )
+  {
+    for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+      pXYZ[i] = (int16)( sum[i] / cnt );
+  }
+  
+  return cnt;
+  
+} // MMA8453QMgr_popAverage
+
+// Returns the number of samples lost since init
+uint16 MMA8453QMgr_getOverrunCnt( void )
+{
+  return MMA8453QMgrFifo.overrunCnt;
+  
+} // MMA8453QMgr_getOverrunCnt
+
+// Returns the latest vertical acceleration (mm/s^2, gravity removed, up positive)
+int32 MMA8453QMgr_getVertAccel( void )
+{
+  return MMA8453QMgr.vertAccel;
+  
+} // MMA8453QMgr_getVertAccel
+
+// Returns the vertical accel activity level (2g counts^2)
+uint16 MMA8453QMgr_getActivity( void )
+{
+  return MMA8453QMgr.activity;
+  
+} // MMA8453QMgr_getActivity
+
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
 
+// Writes a profile image in 6 transactions: STANDBY, one burst per register
+// block (OFF_X/Y/Z ride along with the CTRL block) and ACTIVE.
+static bool MMA8453QMgr_writeProfile( mma8453qMgr_profileId_t profile )
+{
+  const mma8453qMgrProfile_t *pProf = &MMA8453QMgr_profileTbl[profile];
+  uint8 ctrl[MMAMGR_PROF_CTRL_LEN + MMA_NUM_AXES];
+  
+  VOID memcpy( ctrl, pProf->ctrl, MMAMGR_PROF_CTRL_LEN );
+  VOID memcpy( ctrl + MMAMGR_PROF_CTRL_LEN, MMA8453QMgr.offset, MMA_NUM_AXES );
+  
+  // Configuration registers can only be written in STANDBY
+  if( !MMA8453Q_writeReg( MMA_REG_CTRL_REG1, ctrl[MMAMGR_PROF_CTRL_REG1_IDX] ) )
+    return FALSE;
+  if( !MMA8453Q_bulkWrite( MMA_REG_XYZ_DATA_CFG, (uint8 *)pProf->dataCfg, MMAMGR_PROF_DATACFG_LEN ) )
+    return FALSE;
+  if( !MMA8453Q_bulkWrite( MMA_REG_FF_MT_CFG, (uint8 *)pProf->ffmt, MMAMGR_PROF_FFMT_LEN ) )
+    return FALSE;
+  if( !MMA8453Q_bulkWrite( MMA_REG_TRANSIENT_CFG, (uint8 *)pProf->transient, MMAMGR_PROF_TRANS_LEN ) )
+    return FALSE;
+  if( !MMA8453Q_bulkWrite( MMA_REG_ASLP_COUNT, ctrl, sizeof( ctrl ) ) )
+    return FALSE;
+  if( !MMA8453Q_writeReg( MMA_REG_CTRL_REG1, ctrl[MMAMGR_PROF_CTRL_REG1_IDX] | MMA_CTRL_REG1_ACTIVE ) )
+    return FALSE;
+  
+  // Keep the decoded configuration in step with the part
+  MMA8453QMgr.sysOdr = (mma845xq_sysOdr_t)( ctrl[MMAMGR_PROF_CTRL_REG1_IDX] & MMA_CTRL_REG1_ODR_MASK );
+  MMA8453QMgr.slpOdr = (mma845xq_slpOdr_t)( ctrl[MMAMGR_PROF_CTRL_REG1_IDX] & 0xC0 );
+  MMA8453QMgr.actPwrSch = (mma845xq_actPwrSch_t)( ctrl[MMAMGR_PROF_CTRL_REG2_IDX] & 0x03 );
+  MMA8453QMgr.slpPwrSch = (mma845xq_slpPwrSch_t)( ctrl[MMAMGR_PROF_CTRL_REG2_IDX] & 0x18 );
+  MMA8453QMgr.fullScale = (mma845xq_fullScale_t)( pProf->dataCfg[0] & 0x03 );
+  MMA8453QMgr.sleeping = FALSE;
+  return TRUE;
+  
+} // MMA8453QMgr_writeProfile
+
+// Programs OFF_X/Y/Z in one burst, dropping to STANDBY around the write
+static bool MMA8453QMgr_writeOffsets( void )
+{
+  if( !MMA8453Q_setActive( FALSE ) )
+    return FALSE;
+  
+  bool stat = MMA8453Q_bulkWrite( MMA_REG_OFF_X, (uint8 *)MMA8453QMgr.offset, MMA_NUM_AXES );
+  
+  return ( MMA8453Q_setActive( TRUE ) && stat ) ? TRUE : FALSE;
+  
+} // MMA8453QMgr_writeOffsets
+
+static void MMA8453QMgr_fifoOverrun( void )
+{
+  // Saturate rather than wrap so a long run of losses stays visible
+  if( MMA8453QMgrFifo.overrunCnt < 0xFFFF )
+    MMA8453QMgrFifo.overrunCnt++;
+  
+} // MMA8453QMgr_fifoOverrun
+
 
 
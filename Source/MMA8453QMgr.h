@@ -13,29 +13,163 @@
 #include "hal_types.h"
 #include "mujoeI2C.h"
 #include "MMA8453Q.h"
+#include "mujoeToolBox.h"
 
 //#include "OSAL_Memory.h"        // for osal_mem_alloc
-//#include "string.h"             // for memcpy
+#include "string.h"             // for memcpy, memset
 
 ////////////////////////////////////////////////////////////////////////////////
 // DEFINES
 ////////////////////////////////////////////////////////////////////////////////
 
+// 10-bit counts per g at MMA_FS_2G, halved for each dynamic range step
+#define MMAMGR_COUNTS_PER_G_2G          256
+
+// Standard gravity (mm/s^2)
+#define MMAMGR_GRAVITY_MMPS2            9807L
+
+// Gravity estimate low pass, alpha = 1/2^N. N = 6 at 100 Hz ~= 0.64 s time constant
+#define MMAMGR_GRAV_LPF_SHIFT           6
+
+// Fractional bits carried by the gravity estimate
+#define MMAMGR_GRAV_Q                   4
+
+// Activity EWMA, alpha = 1/2^N
+#define MMAMGR_ACTIVITY_SHIFT           3
+
+// The MMA8453Q has no hardware FIFO. DRDY samples are read from the mainTask's
+// GPIO event, and a sample is only kept if that event runs within one ODR
+// period of the edge. The longest jobs between OSAL passes are a black box
+// slice (35 bytes, ~1.2 ms on the 267 kHz bus) and a BLE connection event of
+// similar length. Reads are therefore loss free up to 200 Hz (5 ms). At 400
+// and 800 Hz a late read loses samples; each loss is counted in overrunCnt,
+// and the RPM capture falls back to its nominal rate, see RPM_RATE_TOL_DIV.
+// Depth of the software DRDY sample FIFO, must be a power of 2. 16 samples = 20 ms at 800 Hz
+#define MMAMGR_FIFO_SIZE                16
+
+// Period (ms) at which the collector drains the DRDY sample FIFO
+#define MMAMGR_DRAIN_PERIOD             10
+
+// Auto-sleep after this many 320 ms periods without a transient, 94 ~= 30 s
+#define MMAMGR_ASLP_COUNT               94
+
+// Transient (high passed) wake threshold, 0.063 g/LSB, and debounce (samples at the active ODR)
+#define MMAMGR_TRANSIENT_THS            2
+#define MMAMGR_TRANSIENT_COUNT          2
+
+// Impact (motion) threshold, 0.063 g/LSB on any axis with gravity included. The
+// motion block works on the 8 g internal data whatever the full scale, 80 ~= 5 g
+// sits well above engine vibration and a firm landing. It must hold for
+// consecutive samples, debounced for ~30 ms at the active ODR, so single
+// vibration peaks never reach the black box.
+#define MMAMGR_IMPACT_THS               ( MMA_FF_MT_THS_DBCNTM | 80 )
+#define MMAMGR_IMPACT_COUNT             3       // 100 Hz
+#define MMAMGR_IMPACT_COUNT_800HZ       24
+
+// Profile register image blocks, each written with one burst
+#define MMAMGR_PROF_DATACFG_LEN         2       // XYZ_DATA_CFG thru HP_FILTER_CUTOFF
+#define MMAMGR_PROF_FFMT_LEN            4       // FF_MT_CFG thru FF_MT_COUNT (SRC is read only)
+#define MMAMGR_PROF_TRANS_LEN           4       // TRANSIENT_CFG thru TRANSIENT_COUNT (SRC is read only)
+#define MMAMGR_PROF_CTRL_LEN            6       // ASLP_COUNT thru CTRL_REG5, OFF_X/Y/Z follow in the same burst
+
+// Index of CTRL_REG1 / CTRL_REG2 within the CTRL block
+#define MMAMGR_PROF_CTRL_REG1_IDX       1
+#define MMAMGR_PROF_CTRL_REG2_IDX       2
+
+// Offset calibration: samples averaged, and the largest deviation (counts) from
+// the first sample accepted before the unit is deemed to have moved
+#define MMAMGR_CAL_NUM_SAMPLES          64
+#define MMAMGR_CAL_MAX_DEV              8
+
+// EEPROM record key of the OFF_X/Y/Z values
+#define MMAMGR_OFFSET_RECORD_KEY        0x4F
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
 
+// Named configuration profiles, see MMA8453QMgr_profileTbl
+typedef enum
+{
+  MMAMGR_PROFILE_IDLE = 0,      // 12.5 Hz low power, DRDY only
+  MMAMGR_PROFILE_FLIGHT,        // 100 Hz low noise, DRDY plus auto-sleep, transient wake and impact
+  MMAMGR_PROFILE_VIBRATION,     // 800 Hz normal mode, DRDY plus impact, for vibration capture, may lose samples
+  MMAMGR_PROFILE_MOTION_WAKE,   // 12.5 Hz low power, transient on INT2 only
+  MMAMGR_NUM_PROFILES,
+  
+}mma8453qMgr_profileId_t;
+
+// Const register image of a profile. CTRL_REG1 is held with ACTIVE clear and
+// set once the whole image is written.
+typedef struct mma8453qMgrProfile_def
+{
+  uint8                         dataCfg[MMAMGR_PROF_DATACFG_LEN];
+  uint8                         ffmt[MMAMGR_PROF_FFMT_LEN];
+  uint8                         transient[MMAMGR_PROF_TRANS_LEN];
+  uint8                         ctrl[MMAMGR_PROF_CTRL_LEN];
+  
+}mma8453qMgrProfile_t;
+
 typedef struct MMA8453QMGR_def
 {
   mma845xq_sysOdr_t             sysOdr;         // System Output Data Rate
   mma845xq_slpOdr_t             slpOdr;         // Sleep Mode Output Data Rate
   mma845xq_actPwrSch_t          actPwrSch;      // Active Power Scheme
   mma845xq_slpPwrSch_t          slpPwrSch;      // Sleep Power Scheme 
+  mma845xq_fullScale_t          fullScale;      // Dynamic Range
+  mma8453qMgr_profileId_t       profile;        // Selected profile
+  bool                          highRate;       // TRUE while MMAMGR_PROFILE_VIBRATION overrides the selected profile
+  bool                          sleeping;       // TRUE while auto-sleep reports the unit stationary
+  uint8                         impactSrc;      // FF_MT_SRC of an impact not yet taken, 0 if none
+  int8                          offset[MMA_NUM_AXES];   // OFF_X/Y/Z (2 mg/LSB)
+  
+  bool                          calibrating;    // TRUE while offset calibration samples are collected
+  bool                          calMoved;       // TRUE if the unit moved during calibration
+  uint8                         calCnt;         // Calibration samples collected
+  int16                         calFirst[MMA_NUM_AXES]; // First calibration sample (counts)
+  int32                         calSum[MMA_NUM_AXES];   // Calibration sample sum (counts)
+  
+  bool                          gravInit;       // TRUE once the gravity estimate is seeded
+  int16                         grav[MMA_NUM_AXES];     // Gravity estimate (counts, Q4)
+  int32                         vertAccel;      // Vertical accel, gravity removed, up positive (mm/s^2)
+  uint16                        activity;       // Vertical accel variance (2g counts^2)
 
 } MMA8453QMGR_t;
 
+// Samples pushed by the DRDY interrupt callback, drained by the sensor collector
+typedef struct MMA8453QMGRFIFO_def
+{
+  int16                         xyz[MMAMGR_FIFO_SIZE][MMA_NUM_AXES];
+  volatile uint8                head;           // Next slot to write
+  volatile uint8                tail;           // Next slot to read
+  uint16                        overrunCnt;     // Samples lost to a full FIFO or an overwritten DRDY
+
+} MMA8453QMGRFIFO_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // API FUNCTION PROTOS
 ////////////////////////////////////////////////////////////////////////////////
 
-#endif // MMA8453QMGR_H
\ No newline at end of file
+bool MMA8453QMgr_initHardware( void );
+bool MMA8453QMgr_applyProfile( mma8453qMgr_profileId_t profile );
+mma8453qMgr_profileId_t MMA8453QMgr_getProfile( void );
+void MMA8453QMgr_setOffsets( int8 *pOffset );
+void MMA8453QMgr_getOffsets( int8 *pOffset );
+void MMA8453QMgr_startOffsetCal( void );
+bool MMA8453QMgr_isCalibrating( void );
+bool MMA8453QMgr_accumOffsetCal( int16 *pXYZ );
+bool MMA8453QMgr_applyOffsetCal( void );
+bool MMA8453QMgr_setHighRate( bool highRate );
+uint16 MMA8453QMgr_getSamplePeriod( void );
+bool MMA8453QMgr_updateSysMode( void );
+bool MMA8453QMgr_isSleeping( void );
+uint8 MMA8453QMgr_takeImpact( void );
+void MMA8453QMgr_getGravity( int16 *pGrav );
+void MMA8453QMgr_processSample( int16 *pXYZ );
+void MMA8453QMgr_pushSample( int16 *pXYZ, uint8 status );
+uint8 MMA8453QMgr_popAverage( int16 *pXYZ );
+uint16 MMA8453QMgr_getOverrunCnt( void );
+int32 MMA8453QMgr_getVertAccel( void );
+uint16 MMA8453QMgr_getActivity( void );
+
+#endif // MMA8453QMGR_H
@@ -18,6 +18,56 @@ static MS560702_t MS560702 =
   .i2cWriteAddr = 0,
 };
 
+// Max ADC conversion time (ms) per OSR, rounded up to the OSAL timer resolution.
+// Indexed by MS560702_osr_t >> 1
+static const uint8 MS560702_convTimeTbl[] = 
+{
+  1,    // OSR 256  (0.60 ms)
+  2,    // OSR 512  (1.17 ms)
+  3,    // OSR 1024 (2.28 ms)
+  5,    // OSR 2048 (4.54 ms)
+  10,   // OSR 4096 (9.04 ms)
+};
+
+// CRC4 remainder update table. Processing one byte of the PROM through the
+// bit-serial algorithm of the datasheet is equivalent to:
+// n_rem = ( ( LSB(n_rem) ^ byte ) << 8 ) ^ crc4Tbl[MSB(n_rem)]
+static const uint16 crc4Tbl[256] =
+{
+  0x0000, 0x3000, 0x6000, 0x5000, 0xC000, 0xF000, 0xA000, 0x9000,
+  0xB000, 0x8000, 0xD000, 0xE000, 0x7000, 0x4000, 0x1000, 0x2000,
+  0x5000, 0x6000, 0x3000, 0x0000, 0x9000, 0xA000, 0xF000, 0xC000,
+  0xE000, 0xD000, 0x8000, 0xB000, 0x2000, 0x1000, 0x4000, 0x7000,
+  0xA000, 0x9000, 0xC000, 0xF000, 0x6000, 0x5000, 0x0000, 0x3000,
+  0x1000, 0x2000, 0x7000, 0x4000, 0xD000, 0xE000, 0xB000, 0x8000,
+  0xF000, 0xC000, 0x9000, 0xA000, 0x3000, 0x0000, 0x5000, 0x6000,
+  0x4000, 0x7000, 0x2000, 0x1000, 0x8000, 0xB000, 0xE000, 0xD000,
+  0x7000, 0x4000, 0x1000, 0x2000, 0xB000, 0x8000, 0xD000, 0xE000,
+  0xC000, 0xF000, 0xA000, 0x9000, 0x0000, 0x3000, 0x6000, 0x5000,
+  0x2000, 0x1000, 0x4000, 0x7000, 0xE000, 0xD000, 0x8000, 0xB000,
+  0x9000, 0xA000, 0xF000, 0xC000, 0x5000, 0x6000, 0x3000, 0x0000,
+  0xD000, 0xE000, 0xB000, 0x8000, 0x1000, 0x2000, 0x7000, 0x4000,
+  0x6000, 0x5000, 0x0000, 0x3000, 0xA000, 0x9000, 0xC000, 0xF000,
+  0x8000, 0xB000, 0xE000, 0xD000, 0x4000, 0x7000, 0x2000, 0x1000,
+  0x3000, 0x0000, 0x5000, 0x6000, 0xF000, 0xC000, 0x9000, 0xA000,
+  0xE000, 0xD000, 0x8000, 0xB000, 0x2000, 0x1000, 0x4000, 0x7000,
+  0x5000, 0x6000, 0x3000, 0x0000, 0x9000, 0xA000, 0xF000, 0xC000,
+  0xB000, 0x8000, 0xD000, 0xE000, 0x7000, 0x4000, 0x1000, 0x2000,
+  0x0000, 0x3000, 0x6000, 0x5000, 0xC000, 0xF000, 0xA000, 0x9000,
+  0x4000, 0x7000, 0x2000, 0x1000, 0x8000, 0xB000, 0xE000, 0xD000,
+  0xF000, 0xC000, 0x9000, 0xA000, 0x3000, 0x0000, 0x5000, 0x6000,
+  0x1000, 0x2000, 0x7000, 0x4000, 0xD000, 0xE000, 0xB000, 0x8000,
+  0xA000, 0x9000, 0xC000, 0xF000, 0x6000, 0x5000, 0x0000, 0x3000,
+  0x9000, 0xA000, 0xF000, 0xC000, 0x5000, 0x6000, 0x3000, 0x0000,
+  0x2000, 0x1000, 0x4000, 0x7000, 0xE000, 0xD000, 0x8000, 0xB000,
+  0xC000, 0xF000, 0xA000, 0x9000, 0x0000, 0x3000, 0x6000, 0x5000,
+  0x7000, 0x4000, 0x1000, 0x2000, 0xB000, 0x8000, 0xD000, 0xE000,
+  0x3000, 0x0000, 0x5000, 0x6000, 0xF000, 0xC000, 0x9000, 0xA000,
+  0x8000, 0xB000, 0xE000, 0xD000, 0x4000, 0x7000, 0x2000, 0x1000,
+  0x6000, 0x5000, 0x0000, 0x3000, 0xA000, 0x9000, 0xC000, 0xF000,
+  0xD000, 0xE000, 0xB000, 0x8000, 0x1000, 0x2000, 0x7000, 0x4000,
+};
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // LOCAL FUNCTION PROTOS
@@ -64,6 +114,40 @@ bool MS560702_initHardware( void )
   
 } // MS560702_initHardware
 
+// Initialize the MS560702 IC from a previously validated copy of its PROM (e.g. 
+// cached in EEPROM). Only the CRC word is read back from the IC to confirm the
+// copy belongs to the fitted part, instead of all eight words.
+// Returns TRUE if the copy was accepted, FALSE otherwise (call MS560702_initHardware).
+bool MS560702_loadPROM( uint16 *pProm )
+{
+  uint16 crcWord;
+  
+  // Copy must be self consistent
+  if( crc4( pProm ) != ( pProm[MS5_PROM_CRC_ADDR] & 0x000F ) )
+    return FALSE;
+  
+  // ...and match the fitted IC
+  if( !MS560702_readPROMCoeff( MS5_PROM_CRC_ADDR, &crcWord ) || ( crcWord != pProm[MS5_PROM_CRC_ADDR] ) )
+    return FALSE;
+  
+  VOID memcpy( MS560702.prom, pProm, sizeof( MS560702.prom ) );
+  return TRUE;
+  
+} // MS560702_loadPROM
+
+// Copies the PROM words loaded by MS560702_initHardware/MS560702_loadPROM into pProm
+void MS560702_getPROM( uint16 *pProm )
+{
+  VOID memcpy( pProm, MS560702.prom, sizeof( MS560702.prom ) );
+  
+} // MS560702_getPROM
+
+uint8 MS560702_getI2CAddr( void )
+{
+  return MS560702.i2cWriteAddr;
+  
+} // MS560702_getI2CAddr
+
 // Resets the MS560702 IC 
 // NOTE: Allow at least 3 ms before resuming comms
 bool MS560702_reset( void )
@@ -110,10 +194,68 @@ bool MS560702_readAdcConv( uint32 *pAdcCode )
   
 } // MS560702_readAdcConv
 
-// @TODO: 
-// - Add fncs to read PROM CRC
-// - Add fncs to convert ADC codes to mBar and degrees C (prob better to do this on the central device due to floating pt math)
-// TODO@
+// Returns the time (ms) to wait between triggering a conversion at "osr" and reading it
+uint8 MS560702_getConvTime( MS560702_osr_t osr )
+{
+  uint8 idx = ( (uint8)osr ) >> 1;
+  if( idx >= sizeof( MS560702_convTimeTbl ) )
+    idx = sizeof( MS560702_convTimeTbl ) - 1;
+  
+  return MS560702_convTimeTbl[idx];
+  
+} // MS560702_getConvTime
+
+// Converts raw pressure (D1) and temperature (D2) ADC codes into compensated
+// pressure (Pa, i.e. 0.01 mbar) and temperature (0.01 degC) using the first and
+// second order equations of the datasheet.
+// The datasheet intermediates need up to 41 bits, so OFF and SENS are carried
+// pre-scaled by 2^-9 and 2^-6 respectively to stay within 32-bit math.
+// Returns FALSE if the PROM coefficients have not been loaded.
+bool MS560702_calcCompensated( uint32 presCode, uint32 tempCode, int32 *pPressure, int32 *pTemperature )
+{
+  uint16 *c = MS560702.prom;
+  
+  // Hardware not initialized, abort
+  if( c[MS5_PROM_COEFF1_ADDR] == 0 )
+    return FALSE;
+  
+  // dT = D2 - C5 * 2^8
+  int32 dT = (int32)tempCode - ( ( (int32)c[MS5_PROM_COEFF5_ADDR] ) << 8 );
+  // TEMP = 2000 + dT * C6 / 2^23
+  int32 temp = MS560702_TREF + mujoeToolBox_mulShr32( dT, c[MS5_PROM_COEFF6_ADDR], 23 );
+  // OFF / 2^9 = C2 * 2^8 + C4 * dT / 2^15
+  int32 off = ( ( (int32)c[MS5_PROM_COEFF2_ADDR] ) << 8 ) + mujoeToolBox_mulShr32( dT, c[MS5_PROM_COEFF4_ADDR], 15 );
+  // SENS / 2^6 = C1 * 2^10 + C3 * dT / 2^13
+  int32 sens = ( ( (int32)c[MS5_PROM_COEFF1_ADDR] ) << 10 ) + mujoeToolBox_mulShr32( dT, c[MS5_PROM_COEFF3_ADDR], 13 );
+  
+  // Second order compensation below 20 degC
+  if( temp < MS560702_TREF )
+  {
+    uint32 dTemp = (uint32)( MS560702_TREF - temp );
+    uint32 dTempSq = dTemp * dTemp;
+    
+    off -= (int32)( ( dTempSq * 61 ) >> 13 );           // OFF2 = 61 * (TEMP - 2000)^2 / 2^4
+    sens -= (int32)( dTempSq >> 5 );                    // SENS2 = 2 * (TEMP - 2000)^2
+    
+    // Very low temperature, below -15 degC
+    if( temp < -1500 )
+    {
+      dTemp = (uint32)( -1500 - temp );
+      dTempSq = dTemp * dTemp;
+      off -= (int32)( ( dTempSq * 15 ) >> 9 );          // OFF2 += 15 * (TEMP + 1500)^2
+      sens -= (int32)( dTempSq >> 3 );                  // SENS2 += 8 * (TEMP + 1500)^2
+    }
+    
+    temp -= mujoeToolBox_mulShr32( dT, dT, 31 );        // T2 = dT^2 / 2^31
+  }
+  
+  // P = ( D1 * SENS / 2^21 - OFF ) / 2^15
+  *pPressure = ( mujoeToolBox_mulShr32( (int32)presCode, sens, 24 ) - off ) >> 6;
+  *pTemperature = temp;
+  
+  return TRUE;
+  
+} // MS560702_calcCompensated
 
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
@@ -156,36 +298,22 @@ static bool MS560702_sendCommand( MS560702_cmds_t cmd )
   
 } // MS560702_sendCommand
 
-// Computes the 4-bit crc on eight 16-bit words of PROM data
+// Computes the 4-bit crc on eight 16-bit words of PROM data.
+// Table driven equivalent of the bit-serial algorithm given in the datasheet,
+// the CRC nibble of word 7 is treated as zero.
 static uint8 crc4( uint16 *prom )
 {
-  uint16 n_rem = 0x00;               // crc remainder
-  uint16 crc_read = prom[7];         // original value of the crc
-  prom[7] &= 0xFF00;                 // CRC byte is replaced by 0
+  uint16 n_rem = 0x0000;             // crc remainder
   
-  // operation is performed on bytes
-  for ( uint8 cnt = 0; cnt < 16; cnt++) 
-  {     
-    // choose LSB or MSB
-    if ( cnt % 2 == 1 )
-      n_rem ^= (uint16) ((prom[cnt>>1]) & 0x00FF);  // LSB
-    else
-      n_rem ^= (uint16) (prom[cnt>>1]>>8);          // MSB
+  for( uint8 i = 0; i < MS560702_PROM_NUM_WORDS; i++ )
+  {
+    uint16 word = ( i == MS5_PROM_CRC_ADDR ) ? ( prom[i] & 0xFF00 ) : prom[i];
     
-    for ( uint8 n_bit = 8; n_bit > 0; n_bit-- )
-    {
-        if (n_rem & (0x8000))
-          n_rem = (n_rem << 1) ^ 0x3000;
-        else
-          n_rem = (n_rem << 1);
-    }
+    n_rem = ( ( ( n_rem & 0x00FF ) ^ ( word >> 8 ) ) << 8 ) ^ crc4Tbl[n_rem >> 8];   // MSB
+    n_rem = ( ( ( n_rem & 0x00FF ) ^ ( word & 0x00FF ) ) << 8 ) ^ crc4Tbl[n_rem >> 8]; // LSB
   }
   
   // final 4-bit reminder is CRC code
-  n_rem = (0x000F & (n_rem >> 12));
-  // restore the crc_read to its original place
-  prom[7] = crc_read; 
+  return (uint8)( 0x000F & ( n_rem >> 12 ) );
   
-  return (n_rem ^ 0x0);
-}
-
+} // crc4
@@ -12,6 +12,8 @@
 
 #include "hal_types.h"
 #include "mujoeI2C.h"
+#include "mujoeToolBox.h"
+#include "string.h"             // for memcpy
 
 ////////////////////////////////////////////////////////////////////////////////
 // DEFINES
@@ -19,6 +21,12 @@
 
 #define MS560702_DEFAULT_I2C_WRITE_ADDR     0xEE // Default I2C write address
 
+// Reference temperature of the compensation equations (0.01 degC)
+#define MS560702_TREF                       2000
+
+// Number of 16-bit PROM words
+#define MS560702_PROM_NUM_WORDS             8
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
@@ -65,7 +73,7 @@ typedef enum
 typedef struct MS560702_def
 {
   uint8         i2cWriteAddr;
-  uint16        prom[8];        // Index 0: Mfg reserved, Indices 1-6: Coefficients, Index 7: CRC for coefficients
+  uint16        prom[MS560702_PROM_NUM_WORDS];        // Index 0: Mfg reserved, Indices 1-6: Coefficients, Index 7: CRC for coefficients
   
 }MS560702_t;
 
@@ -75,10 +83,15 @@ typedef struct MS560702_def
 
 bool MS560702_initDriver( bool csbState );
 bool MS560702_initHardware( void );
+bool MS560702_loadPROM( uint16 *pProm );
+void MS560702_getPROM( uint16 *pProm );
+uint8 MS560702_getI2CAddr( void );
 bool MS560702_reset( void );
 bool MS560702_trigPressureConv( MS560702_osr_t osr );
 bool MS560702_trigTemperatureConv( MS560702_osr_t osr );
 bool MS560702_readAdcConv( uint32 *pAdcCode );
+uint8 MS560702_getConvTime( MS560702_osr_t osr );
+bool MS560702_calcCompensated( uint32 presCode, uint32 tempCode, int32 *pPressure, int32 *pTemperature );
 
 
 #endif // MS560702
\ No newline at end of file
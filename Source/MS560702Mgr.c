@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: MS560702Mgr.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "MS560702Mgr.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static MS560702MGR_t    MS560702Mgr;
+
+// OSR levels, shortest conversion first
+static const MS560702_osr_t MS560702Mgr_osrTbl[MS5MGR_NUM_OSR_LVLS] = 
+{
+  MS5_OSR_256,
+  MS5_OSR_512,
+  MS5_OSR_1024,
+  MS5_OSR_2048,
+  MS5_OSR_4096,
+};
+
+// Datasheet RMS pressure noise per OSR level as variance (Pa^2, Q4):
+// 13, 8.4, 5.4, 3.6 and 2.4 Pa RMS
+static const uint16 MS560702Mgr_noiseVarTbl[MS5MGR_NUM_OSR_LVLS] = 
+{
+  2704,
+  1129,
+  467,
+  207,
+  92,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static uint8 MS560702Mgr_selectOsrLvl( uint32 sigVar );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+void MS560702Mgr_init( void )
+{
+  VOID memset( &MS560702Mgr, 0, sizeof( MS560702MGR_t ) );
+  
+  // Start at the highest resolution until the variance estimate settles
+  MS560702Mgr.maxOsrLvl = MS5MGR_NUM_OSR_LVLS - 1;
+  MS560702Mgr.osrLvl = MS560702Mgr.maxOsrLvl;
+  
+} // MS560702Mgr_init
+
+// Feeds a compensated pressure sample (Pa) into the controller.
+// The short-term variance is estimated from first differences so a steady climb
+// or descent does not read as noise. The part of it not explained by the sensor
+// noise at the current OSR is the signal variance. The lowest OSR whose sensor
+// noise stays below both the target floor and the signal variance is chosen.
+// Once the signal is that busy, more resolution only costs conversion time.
+void MS560702Mgr_update( int32 pressure )
+{
+  if( !MS560702Mgr.havePrev )
+  {
+    MS560702Mgr.prevPres = pressure;
+    MS560702Mgr.havePrev = TRUE;
+    return;
+  }
+  
+  int32 diff = pressure - MS560702Mgr.prevPres;
+  MS560702Mgr.prevPres = pressure;
+  if( diff > MS5MGR_MAX_PRES_STEP ){ diff = MS5MGR_MAX_PRES_STEP; }
+  if( diff < -MS5MGR_MAX_PRES_STEP ){ diff = -MS5MGR_MAX_PRES_STEP; }
+  
+  // Var(diff) = 2 * Var(noise) for white noise. EWMA with alpha = 1/8
+  uint32 sample = ( (uint32)( diff * diff ) ) << 3;
+  MS560702Mgr.presVar = MS560702Mgr.presVar - ( MS560702Mgr.presVar >> 3 ) + ( sample >> 3 );
+  
+  uint16 noiseVar = MS560702Mgr_noiseVarTbl[MS560702Mgr.osrLvl];
+  uint32 sigVar = ( MS560702Mgr.presVar > noiseVar ) ? ( MS560702Mgr.presVar - noiseVar ) : 0;
+  
+  // Step one OSR level at a time once the request has held for MS5MGR_OSR_HOLD_CNT samples
+  uint8 wantLvl = MS560702Mgr_selectOsrLvl( sigVar );
+  if( wantLvl > MS560702Mgr.maxOsrLvl ){ wantLvl = MS560702Mgr.maxOsrLvl; }
+  int8 dir = ( wantLvl > MS560702Mgr.osrLvl ) ? 1 : ( ( wantLvl < MS560702Mgr.osrLvl ) ? -1 : 0 );
+  
+  if( dir == 0 )
+    MS560702Mgr.holdCnt = 0;
+  else if( dir == MS560702Mgr.holdDir )
+    MS560702Mgr.holdCnt++;
+  else
+  {
+    MS560702Mgr.holdDir = dir;
+    MS560702Mgr.holdCnt = 1;
+  }
+  
+  if( MS560702Mgr.holdCnt >= MS5MGR_OSR_HOLD_CNT )
+  {
+    MS560702Mgr.osrLvl += dir;
+    MS560702Mgr.holdCnt = 0;
+  }
+  
+  MS560702Mgr.active = ( ( sigVar > MS5MGR_ACTIVE_SIG_VAR ) || 
+                         ( MS560702Mgr.accelActivity > MS5MGR_ACTIVE_ACCEL_LVL ) ) ? TRUE : FALSE;
+  
+} // MS560702Mgr_update
+
+// Accelerometer activity level (e.g. short-term variance of the accel magnitude).
+// Activity above MS5MGR_ACTIVE_ACCEL_LVL selects the active sample period even
+// while the pressure signal is quiet.
+void MS560702Mgr_updateAccelActivity( uint16 activity )
+{
+  MS560702Mgr.accelActivity = activity;
+  
+} // MS560702Mgr_updateAccelActivity
+
+MS560702_osr_t MS560702Mgr_getOsr( void )
+{
+  return MS560702Mgr_osrTbl[MS560702Mgr.osrLvl];
+  
+} // MS560702Mgr_getOsr
+
+// Returns the active OSR level: 0 = OSR 256 ... 4 = OSR 4096
+uint8 MS560702Mgr_getOsrLvl( void )
+{
+  return MS560702Mgr.osrLvl;
+  
+} // MS560702Mgr_getOsrLvl
+
+// Returns the period (ms) between pressure/temperature sample pairs
+uint16 MS560702Mgr_getSamplePeriod( void )
+{
+  uint16 period = MS560702Mgr.active ? MS5MGR_PERIOD_ACTIVE : MS5MGR_PERIOD_IDLE;
+  return ( period < MS560702Mgr.minPeriod ) ? MS560702Mgr.minPeriod : period;
+  
+} // MS560702Mgr_getSamplePeriod
+
+// Caps the OSR level the controller may select and sets the shortest sample
+// period (ms), 0 for none. A level above the new cap is dropped at once.
+void MS560702Mgr_setLimits( uint8 maxOsrLvl, uint16 minPeriod )
+{
+  if( maxOsrLvl >= MS5MGR_NUM_OSR_LVLS )
+    maxOsrLvl = MS5MGR_NUM_OSR_LVLS - 1;
+  
+  MS560702Mgr.maxOsrLvl = maxOsrLvl;
+  MS560702Mgr.minPeriod = minPeriod;
+  if( MS560702Mgr.osrLvl > maxOsrLvl )
+    MS560702Mgr.osrLvl = maxOsrLvl;
+  MS560702Mgr.holdCnt = 0;
+  
+} // MS560702Mgr_setLimits
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Returns the lowest OSR level whose sensor noise is within the allowed variance
+static uint8 MS560702Mgr_selectOsrLvl( uint32 sigVar )
+{
+  // Sensor noise is hidden once it is below half the signal RMS
+  uint32 allowedVar = sigVar >> 2;
+  if( allowedVar < MS5MGR_TARGET_NOISE_VAR )
+    allowedVar = MS5MGR_TARGET_NOISE_VAR;
+  
+  for( uint8 lvl = 0; lvl < MS5MGR_NUM_OSR_LVLS; lvl++ )
+  {
+    if( MS560702Mgr_noiseVarTbl[lvl] <= allowedVar )
+      return lvl;
+  }
+  
+  return MS5MGR_NUM_OSR_LVLS - 1;
+  
+} // MS560702Mgr_selectOsrLvl
@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: MS560702Mgr.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MS560702MGR_H
+#define MS560702MGR_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "MS560702.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of selectable OSR levels (256 thru 4096)
+#define MS5MGR_NUM_OSR_LVLS             5
+
+// Target pressure noise floor, variance in Pa^2 (Q4). 3 Pa RMS ~= 25 cm
+#define MS5MGR_TARGET_NOISE_VAR         ( 9 << 4 )
+
+// Signal variance (Pa^2, Q4) above which the barometer is considered active
+#define MS5MGR_ACTIVE_SIG_VAR           ( 25 << 4 )
+
+// Accel activity level above which the barometer is considered active
+#define MS5MGR_ACTIVE_ACCEL_LVL         64
+
+// Sample periods (ms) while active / idle
+#define MS5MGR_PERIOD_ACTIVE            50
+#define MS5MGR_PERIOD_IDLE              500
+
+// Number of consecutive samples that must agree before the OSR is stepped
+#define MS5MGR_OSR_HOLD_CNT             4
+
+// Pressure steps larger than this (Pa) are clamped before entering the variance
+#define MS5MGR_MAX_PRES_STEP            1000
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct MS560702MGR_def
+{
+  uint8                 osrLvl;         // Active OSR level, index into MS5MGR OSR table
+  uint8                 maxOsrLvl;      // Highest OSR level the controller may select
+  uint16                minPeriod;      // Shortest sample period (ms), 0 for none
+  uint8                 holdCnt;        // Consecutive samples requesting an OSR step
+  int8                  holdDir;        // Direction of the requested OSR step
+  bool                  active;         // TRUE if flight rate sampling is selected
+  bool                  havePrev;       // TRUE once prevPres is valid
+  int32                 prevPres;       // Previous pressure sample (Pa)
+  uint32                presVar;        // Short-term pressure variance (Pa^2, Q4)
+  uint16                accelActivity;  // Latest accel activity level
+
+} MS560702MGR_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void MS560702Mgr_init( void );
+void MS560702Mgr_update( int32 pressure );
+void MS560702Mgr_updateAccelActivity( uint16 activity );
+MS560702_osr_t MS560702Mgr_getOsr( void );
+uint8 MS560702Mgr_getOsrLvl( void );
+uint16 MS560702Mgr_getSamplePeriod( void );
+void MS560702Mgr_setLimits( uint8 maxOsrLvl, uint16 minPeriod );
+
+#endif // MS560702MGR_H
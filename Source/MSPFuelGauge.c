@@ -28,11 +28,101 @@ static mspfg_t  mspfg =
 
 bool mspfg_sendCommand( uint8 cmd )
 {
-  if( mujoeI2C_write( mspfg.i2cWriteAddr, 1, &cmd, STOP_CMD ) )
-    return FALSE;
+  return ( mujoeI2C_write( mspfg.i2cWriteAddr, 1, &cmd, STOP_CMD ) == 1 ) ? TRUE : FALSE;
+  
+} // mspfg_sendCommand
+
+bool mspfg_readReg( mspfg_regAddr_t addr, uint8 *pData )
+{
+  uint8 u8_addr = (uint8)addr;
+  if( mujoeI2C_write( mspfg.i2cWriteAddr, 1, &u8_addr, REPEAT_CMD ) )
+    return ( mujoeI2C_read( mspfg.i2cWriteAddr, 1, pData ) == 1 ) ? TRUE : FALSE;
   else
-    return TRUE;
-}
+    return FALSE;
+  
+} // mspfg_readReg
+
+bool mspfg_writeReg( mspfg_regAddr_t addr, uint8 data )
+{
+  uint8 buff[2];
+  buff[0] = (uint8)addr;
+  buff[1] = data;
+  
+  return ( mujoeI2C_write( mspfg.i2cWriteAddr, 2, buff, STOP_CMD ) == 2 ) ? TRUE : FALSE;
+  
+} // mspfg_writeReg
+
+// Reads MSPFG_CAP_FULL_LSB thru MSPFG_FUEL_LVL as one burst and decodes it
+bool mspfg_readSnapshot( mspfgSnapshot_t *pSnap )
+{
+  uint8 buff[MSPFG_SNAPSHOT_LEN];
+  uint8 u8_addr = (uint8)MSPFG_CAP_FULL_LSB;
+  
+  if( !mujoeI2C_write( mspfg.i2cWriteAddr, 1, &u8_addr, REPEAT_CMD ) )
+    return FALSE;
+  if( mujoeI2C_read( mspfg.i2cWriteAddr, MSPFG_SNAPSHOT_LEN, buff ) != MSPFG_SNAPSHOT_LEN )
+    return FALSE;
+  
+  pSnap->capFull = ( (uint16)buff[MSPFG_CAP_FULL_MSB - MSPFG_CAP_FULL_LSB] << 8 ) + 
+                   buff[MSPFG_CAP_FULL_LSB - MSPFG_CAP_FULL_LSB];
+  pSnap->capAlgo = ( (uint16)buff[MSPFG_CAP_ALGO_MSB - MSPFG_CAP_FULL_LSB] << 8 ) + 
+                   buff[MSPFG_CAP_ALGO_LSB - MSPFG_CAP_FULL_LSB];
+  pSnap->capRaw = ( (uint16)buff[MSPFG_CAP_RAW_MSB - MSPFG_CAP_FULL_LSB] << 8 ) + 
+                  buff[MSPFG_CAP_RAW_LSB - MSPFG_CAP_FULL_LSB];
+  pSnap->fuelLvlCritThresh = buff[MSPFG_FUEL_LVL_CRIT_THRESH - MSPFG_CAP_FULL_LSB];
+  pSnap->fuelLvl = buff[MSPFG_FUEL_LVL - MSPFG_CAP_FULL_LSB];
+  
+  return TRUE;
+  
+} // mspfg_readSnapshot
+
+// Reads only the algo and raw capacitances, the shortest burst that yields both
+bool mspfg_readCaps( uint16 *pCapAlgo, uint16 *pCapRaw )
+{
+  uint8 buff[MSPFG_CAPS_LEN];
+  uint8 u8_addr = (uint8)MSPFG_CAP_ALGO_LSB;
+  
+  if( !mujoeI2C_write( mspfg.i2cWriteAddr, 1, &u8_addr, REPEAT_CMD ) )
+    return FALSE;
+  if( mujoeI2C_read( mspfg.i2cWriteAddr, MSPFG_CAPS_LEN, buff ) != MSPFG_CAPS_LEN )
+    return FALSE;
+  
+  *pCapAlgo = ( (uint16)buff[MSPFG_CAP_ALGO_MSB - MSPFG_CAP_ALGO_LSB] << 8 ) + 
+              buff[MSPFG_CAP_ALGO_LSB - MSPFG_CAP_ALGO_LSB];
+  *pCapRaw = ( (uint16)buff[MSPFG_CAP_RAW_MSB - MSPFG_CAP_ALGO_LSB] << 8 ) + 
+             buff[MSPFG_CAP_RAW_LSB - MSPFG_CAP_ALGO_LSB];
+  
+  return TRUE;
+  
+} // mspfg_readCaps
+
+bool mspfg_writeConfig( uint8 cfg )
+{
+  return mspfg_writeReg( MSPFG_CFG, cfg );
+  
+} // mspfg_writeConfig
+
+// Sets the full tank capacitance, LSByte and MSByte written in one burst
+bool mspfg_setCapFull( uint16 capFull )
+{
+  uint8 buff[3];
+  buff[0] = (uint8)MSPFG_CAP_FULL_LSB;
+  buff[1] = (uint8)( capFull & 0x00FF );
+  buff[2] = (uint8)( capFull >> 8 );
+  
+  return ( mujoeI2C_write( mspfg.i2cWriteAddr, 3, buff, STOP_CMD ) == 3 ) ? TRUE : FALSE;
+  
+} // mspfg_setCapFull
+
+// Sets the critical fuel level threshold (0 to MSPFG_FUEL_LVL_MAX %)
+bool mspfg_setFuelLvlCritThresh( uint8 thresh )
+{
+  if( thresh > MSPFG_FUEL_LVL_MAX )
+    return FALSE;
+  
+  return mspfg_writeReg( MSPFG_FUEL_LVL_CRIT_THRESH, thresh );
+  
+} // mspfg_setFuelLvlCritThresh
 
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
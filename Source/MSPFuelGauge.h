@@ -24,6 +24,15 @@
 #define MSPFG_CMD_SINGLESHOT_DATA       0x83    // Trigger a single shot measurement
 #define MSPFG_CMD_SLEEP                 0x84    // Put MSPFuelGauge to sleep
 
+// Snapshot burst, MSPFG_CAP_FULL_LSB thru MSPFG_FUEL_LVL
+#define MSPFG_SNAPSHOT_LEN              ( MSPFG_FUEL_LVL - MSPFG_CAP_FULL_LSB + 1 )
+
+// Capacitance burst, MSPFG_CAP_ALGO_LSB thru MSPFG_CAP_RAW_MSB
+#define MSPFG_CAPS_LEN                  ( MSPFG_CAP_RAW_MSB - MSPFG_CAP_ALGO_LSB + 1 )
+
+// Fuel level register range (%)
+#define MSPFG_FUEL_LVL_MAX              100
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
@@ -45,6 +54,18 @@ typedef enum
 }mspfg_regAddr_t;
 
 
+// Decoded MSPFG_CAP_FULL_LSB thru MSPFG_FUEL_LVL, read in one transaction so
+// the capacitances and the level derived from them are consistent
+typedef struct mspfgSnapshot_def
+{
+  uint16        capFull;                // Capacitance when tank full
+  uint16        capAlgo;                // Tracking algo capacitance
+  uint16        capRaw;                 // Raw capacitance
+  uint8         fuelLvlCritThresh;      // Critical fuel level threshold (%)
+  uint8         fuelLvl;                // Fuel level (%)
+  
+}mspfgSnapshot_t;
+
 typedef struct mspfg_def
 {
   uint8         i2cWriteAddr;
@@ -56,5 +77,12 @@ typedef struct mspfg_def
 ////////////////////////////////////////////////////////////////////////////////
 
 bool mspfg_sendCommand( uint8 cmd );
+bool mspfg_readReg( mspfg_regAddr_t addr, uint8 *pData );
+bool mspfg_writeReg( mspfg_regAddr_t addr, uint8 data );
+bool mspfg_readSnapshot( mspfgSnapshot_t *pSnap );
+bool mspfg_readCaps( uint16 *pCapAlgo, uint16 *pCapRaw );
+bool mspfg_writeConfig( uint8 cfg );
+bool mspfg_setCapFull( uint16 capFull );
+bool mspfg_setFuelLvlCritThresh( uint8 thresh );
 
 #endif // MSPFUELGAUGE_H
\ No newline at end of file
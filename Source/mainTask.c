@@ -64,6 +64,7 @@ typedef enum
   STATLED_ON,
   STATLED_FASTBLINK,
   STATLED_SLOWBLINK,
+  STATLED_ALARM,
   
 }statLedState_t;
 
@@ -90,6 +91,7 @@ typedef struct mainTask_def
  */
 
 static statLedState_t   statLedState = STATLED_OFF;
+static statLedState_t   statLedReqState = STATLED_OFF;    // State to restore once the alarm clears
 
 static mainTask_t       mainTask =
 {
@@ -97,7 +99,9 @@ static mainTask_t       mainTask =
 };
 
 static uint16           rspBuffer;         // TEST
-static uint8            asyncBulkBuff[20]; // TEST
+static uint8            asyncBulkBuff[MUJOEDATAPROFILE_ASYNCBULK_LEN];
+static mujoeSampleRingCursor_t asyncBulkCur[SRING_NUM_CH];   // Async Bulk read position in each sample ring channel
+static uint8            asyncBulkShift = 0;                 // Operating profile log rate, period = requested period << asyncBulkShift
 
 // HipScience characteristic notification control identifiers
 static uint8                            mainTask_TaskID;             // Task ID for internal task/event processing
@@ -177,6 +181,9 @@ static void mainTask_endAdvert( void );
 static void mainTask_pbIntHdlr( void );
 static void mainTask_brdLedMgr( void );
 static void mainTask_setStatLEDState( statLedState_t newState );
+static void mainTask_fuelAlarm( void );
+static void mainTask_buildAsyncBulk( uint8 *pBuff );
+static void mainTask_applyOpProfile( void );
 
 /*********************************************************************
  * PROFILE CALLBACKS
@@ -407,6 +414,14 @@ uint16 mainTask_ProcessEvent( uint8 task_id, uint16 events )
 
   VOID task_id; // OSAL required parameter that isn't used in this function
 
+  // Critical Fuel Alarm Event, ahead of everything else so the pilot is told
+  // on the next pass of the OSAL loop
+  if( events & MAIN_FUEL_ALARM_EVT )
+  {
+    mainTask_fuelAlarm();
+    return ( events ^ MAIN_FUEL_ALARM_EVT );
+  }
+
   // OSAL Message Received event
   if ( events & SYS_EVENT_MSG )
   {
@@ -455,16 +470,29 @@ uint16 mainTask_ProcessEvent( uint8 task_id, uint16 events )
      if ( SBP_PERIODIC_EVT_PERIOD )
         osal_start_timerEx( mainTask_TaskID, 
                             MAIN_ASYNCBULK_EVT, 
-                            mujoeBrdSettings.asyncBulkSampPeriod );
+                            mujoeBrdSettings.asyncBulkSampPeriod << asyncBulkShift );
      
-     // BEGIN TEST
-     if( muJoeDataProfile_writeAsyncBulk( asyncBulkBuff, sizeof( asyncBulkBuff ) ) == SUCCESS )
-       asyncBulkBuff[0]++;
-     // END TEST
+     // Capture frames own the characteristic while a capture runs
+     if( !mujoeFuelCap_isActive() )
+     {
+       mainTask_buildAsyncBulk( asyncBulkBuff );
+       if( muJoeDataProfile_writeAsyncBulk( asyncBulkBuff, sizeof( asyncBulkBuff ) ) == SUCCESS )
+         asyncBulkBuff[ASYNCBULK_SEQ_IDX]++;
+     }
      
      return ( events ^ MAIN_ASYNCBULK_EVT );
   }
   
+  // Fuel Capacitance Capture Frame Ready event
+  if( events & MAIN_FUEL_CAPTURE_EVT )
+  {
+    uint8 *pFrame = mujoeFuelCap_getFrame();
+    if( pFrame != NULL )
+      mujoeFuelCap_releaseFrame( ( muJoeDataProfile_writeAsyncBulk( pFrame, FUELCAP_FRAME_LEN ) == SUCCESS ) ? TRUE : FALSE );
+    
+    return ( events ^ MAIN_FUEL_CAPTURE_EVT );
+  }
+  
   // GPIO Interrupt Manager event
   if ( events & MAIN_GPIOINTMGR_EVT )
   {
@@ -519,6 +547,10 @@ static void mainTask_brdLedMgr( void )
       muJoeGPIO_togglePin( PINID_STATUS_LED );
       ledPeriod = 500;
       break;
+    case STATLED_ALARM:
+      muJoeGPIO_togglePin( PINID_STATUS_LED );
+      ledPeriod = 100;
+      break;
     default:
       break;
   }
@@ -528,14 +560,116 @@ static void mainTask_brdLedMgr( void )
   
 }// mainTask_brdLedMgr
 
+// Packs the latest sensor data into the Async Bulk layout defined in mainTask.h.
+// The vertical speed is read from the live variometer state rather than the last
+// collector sweep so it is as fresh as possible when the notification goes out.
+static void mainTask_buildAsyncBulk( uint8 *pBuff )
+{
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  uint8 fresh = 0;
+  uint8 idx;
+  
+  // Sampled channels take their newest ring sample, the others keep the
+  // values of the previous packet
+  idx = mujoeSampleRing_latest( SRING_CH_BARO, &asyncBulkCur[SRING_CH_BARO] );
+  if( idx != SRING_NONE )
+  {
+    int32 pres = mujoeSampleRing.pres[idx];
+    int16 temp = mujoeSampleRing.temp[idx];
+    pBuff[ASYNCBULK_PRES_IDX]       = (uint8)( pres >> 16 );
+    pBuff[ASYNCBULK_PRES_IDX + 1]   = (uint8)( pres >> 8 );
+    pBuff[ASYNCBULK_PRES_IDX + 2]   = (uint8)( pres );
+    pBuff[ASYNCBULK_TEMP_IDX]       = HI_UINT16( (uint16)temp );
+    pBuff[ASYNCBULK_TEMP_IDX + 1]   = LO_UINT16( (uint16)temp );
+    fresh |= ASYNCBULK_FRESH_BARO;
+  }
+  if( mujoeSampleRing_latest( SRING_CH_ACCEL, &asyncBulkCur[SRING_CH_ACCEL] ) != SRING_NONE )
+    fresh |= ASYNCBULK_FRESH_ACCEL;
+  idx = mujoeSampleRing_latest( SRING_CH_FUEL, &asyncBulkCur[SRING_CH_FUEL] );
+  if( idx != SRING_NONE )
+  {
+    pBuff[ASYNCBULK_FUEL_LVL_IDX]   = (uint8)( ( mujoeSampleRing.fuelLvl[idx] + 50 ) / 100 );
+    pBuff[ASYNCBULK_FUEL_CONF_IDX]  = mujoeSampleRing.fuelConf[idx];
+    fresh |= ASYNCBULK_FRESH_FUEL;
+  }
+  uint16 health = sensorMgrTask_getHealth();
+  pBuff[ASYNCBULK_HEALTH_IDX]       = HI_UINT16( health );
+  pBuff[ASYNCBULK_HEALTH_IDX + 1]   = LO_UINT16( health );
+  pBuff[ASYNCBULK_STATE_IDX]        = fresh |
+                                      ( ( (uint8)mujoeOpProfile_getActive() << ASYNCBULK_PROFILE_SHIFT ) & ASYNCBULK_PROFILE_MASK ) |
+                                      ( ( mujoeOpProfile_getSelection() == OPPROFILE_AUTO ) ? ASYNCBULK_PROFILE_AUTO : 0 );
+  
+  pBuff[ASYNCBULK_BAR_OSR_IDX]      = MS560702Mgr_getOsrLvl();
+  pBuff[ASYNCBULK_RPM_IDX]          = HI_UINT16( pDat->engRpm );
+  pBuff[ASYNCBULK_RPM_IDX + 1]      = LO_UINT16( pDat->engRpm );
+  pBuff[ASYNCBULK_FUEL_BURN_IDX]    = HI_UINT16( (uint16)pDat->fuelBurnRate );
+  pBuff[ASYNCBULK_FUEL_BURN_IDX + 1]= LO_UINT16( (uint16)pDat->fuelBurnRate );
+  pBuff[ASYNCBULK_FUEL_TTE_IDX]     = HI_UINT16( pDat->fuelTte );
+  pBuff[ASYNCBULK_FUEL_TTE_IDX + 1] = LO_UINT16( pDat->fuelTte );
+  
+  int16 vario = mujoeVario_getVerticalSpeed();
+  pBuff[ASYNCBULK_VARIO_IDX]        = HI_UINT16( (uint16)vario );
+  pBuff[ASYNCBULK_VARIO_IDX + 1]    = LO_UINT16( (uint16)vario );
+  
+} // mainTask_buildAsyncBulk
+
 static void mainTask_setStatLEDState( statLedState_t newState )
 {
+  // The alarm pattern holds until the alarm clears, other states are deferred
+  statLedReqState = newState;
+  if( brdSensorDat.ppgfg.fuelCrit )
+    newState = STATLED_ALARM;
+  
   statLedState = newState;
   osal_stop_timerEx( mainTask_TaskID, MAIN_BRD_LEDMGR_EVT );
   osal_set_event( mainTask_TaskID, MAIN_BRD_LEDMGR_EVT );
   
 } // mainTask_setStatLEDState
 
+// Pushes the critical fuel state straight out on the Response characteristic,
+// bypassing the solicited response delay and the Async Bulk period, and switches
+// the status LED to or from the alarm pattern
+static void mainTask_fuelAlarm( void )
+{
+  bool crit = brdSensorDat.ppgfg.fuelCrit;
+  
+  VOID muJoeGenProfile_writeResponse( crit ? MUJOE_NOTI_FUEL_CRIT : MUJOE_NOTI_FUEL_CRIT_CLR );
+  mainTask_setStatLEDState( statLedReqState );
+  
+} // mainTask_fuelAlarm
+
+// Switches every rate to the target operating profile in one pass: sensors,
+// link and log rate. The connection parameters are requested on a live link
+// and kept for the next one.
+static void mainTask_applyOpProfile( void )
+{
+  mujoeOpProfileId_t id = mujoeOpProfile_getTarget();
+  if( id == mujoeOpProfile_getActive() )
+    return;
+  
+  const mujoeOpProfileCfg_t *pCfg = mujoeOpProfile_getCfg( id );
+  uint16 connIntMin = pCfg->connIntMin;
+  uint16 connIntMax = pCfg->connIntMax;
+  uint16 slaveLatency = pCfg->slaveLatency;
+  
+  sensorMgrTask_applyOpProfile( pCfg );
+  
+  // A fuel capture holds off the critical fuel alarm, it only runs on the ground
+  if( id != OPPROFILE_GROUND )
+    sensorMgrTask_stopFuelCapture();
+  
+  GAPRole_SetParameter( GAPROLE_MIN_CONN_INTERVAL, sizeof( uint16 ), &connIntMin );
+  GAPRole_SetParameter( GAPROLE_MAX_CONN_INTERVAL, sizeof( uint16 ), &connIntMax );
+  GAPRole_SetParameter( GAPROLE_SLAVE_LATENCY, sizeof( uint16 ), &slaveLatency );
+  if( gapProfileState == GAPROLE_CONNECTED )
+    VOID GAPRole_SendUpdateParam( connIntMin, connIntMax, slaveLatency, 
+                                  DEFAULT_DESIRED_CONN_TIMEOUT, GAPROLE_NO_ACTION );
+  
+  asyncBulkShift = pCfg->logShift;
+  mujoeOpProfile_setActive( id );
+  
+} // mainTask_applyOpProfile
+
 static void mainTask_pbIntHdlr( void )
 {
   muJoeGPIO_togglePin( PINID_CHG_LED );
@@ -612,6 +746,19 @@ static void mainTask_ProcessSensorMgrMsg( msg_t *msg )
     case SENSORMGR_HWINIT_DONE:
       muJoeGPIO_writePin( PINID_CHG_LED, FALSE );
       enableP1PinInterrupt(0x20);       // TEST: Unmask P1.5 interrupt
+      mainTask_applyOpProfile();
+      break;
+    case SENSORMGR_FUEL_TTE_ALERT:
+      muJoeGenMgr_issueNotification( MUJOE_NOTI_FUEL_TTE | mujoeFuelBurn_getAlertLvl() );
+      break;
+    case SENSORMGR_OPPROFILE_CHANGE:
+      mainTask_applyOpProfile();
+      break;
+    case SENSORMGR_ACCEL_CAL_DONE:
+      muJoeGenMgr_issueNotification( MUJOE_NOTI_ACCEL_CAL_DONE );
+      break;
+    case SENSORMGR_ACCEL_CAL_FAIL:
+      muJoeGenMgr_issueNotification( MUJOE_NOTI_ACCEL_CAL_FAIL );
       break;
     default:
       break;
@@ -57,6 +57,35 @@ extern "C"
 #define MAIN_ADVEND_EVT                                   0x0020
 #define MAIN_GPIOINTMGR_EVT                               0x0040
 #define MAIN_BRD_LEDMGR_EVT                               0x0080
+#define MAIN_FUEL_ALARM_EVT                               0x0100    // Checked first, see mainTask_ProcessEvent
+#define MAIN_FUEL_CAPTURE_EVT                             0x0200
+
+// Async Bulk packet layout (byte offsets, multi-byte fields are MSB first). The
+// packet fills one notification at the default ATT MTU, MUJOEDATAPROFILE_ASYNCBULK_LEN.
+#define ASYNCBULK_SEQ_IDX                                 0     // uint8: Packet counter
+#define ASYNCBULK_VARIO_IDX                               1     // int16: Vertical speed (cm/s)
+#define ASYNCBULK_PRES_IDX                                3     // uint24: Pressure (Pa)
+#define ASYNCBULK_TEMP_IDX                                6     // int16: Temperature (0.01 degC)
+#define ASYNCBULK_BAR_OSR_IDX                             8     // uint8: Barometer OSR level (0 = 256 ... 4 = 4096)
+#define ASYNCBULK_RPM_IDX                                 9     // uint16: Engine speed (RPM), 0 if not running
+#define ASYNCBULK_FUEL_LVL_IDX                            11    // uint8: Filtered, tilt corrected fuel level (%)
+#define ASYNCBULK_FUEL_CONF_IDX                           12    // uint8: Fuel level confidence (%)
+#define ASYNCBULK_FUEL_BURN_IDX                           13    // int16: Fuel burn rate (0.01 %/h)
+#define ASYNCBULK_FUEL_TTE_IDX                            15    // uint16: Predicted time to empty (min), 0xFFFF if unknown
+#define ASYNCBULK_HEALTH_IDX                              17    // uint16: Sensor health, SENSORMGR_HEALTH_FAULT/OFFLINE bits per sensor slot
+#define ASYNCBULK_STATE_IDX                               19    // uint8: ASYNCBULK_FRESH_* bits and ASYNCBULK_PROFILE_* fields
+
+// Async Bulk state byte: channels sampled since the previous packet, one bit
+// per sample ring channel
+#define ASYNCBULK_FRESH_BARO                              0x01
+#define ASYNCBULK_FRESH_ACCEL                             0x02
+#define ASYNCBULK_FRESH_FUEL                              0x04
+
+// Async Bulk state byte: operating profile (mujoeOpProfileId_t), and a flag set
+// while the profile is selected automatically
+#define ASYNCBULK_PROFILE_SHIFT                           4
+#define ASYNCBULK_PROFILE_MASK                            0x30
+#define ASYNCBULK_PROFILE_AUTO                            0x80
 
 /*********************************************************************
  * MACROS
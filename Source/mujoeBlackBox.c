@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeBlackBox.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeBlackBox.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeBlackBox_t  mujoeBlackBox =
+{
+  .state = BBOX_STATE_ARMED,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static void mujoeBlackBox_rearm( void );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Finds the first free event slot. Requires the EEPROM to be initialized.
+void mujoeBlackBox_init( void )
+{
+  mujoeBlackBoxHdr_t hdr;
+
+  VOID memset( &mujoeBlackBox, 0, sizeof( mujoeBlackBox_t ) );
+
+  // Slots are filled in order, the first without a valid header is free
+  while( mujoeBlackBox.nextSlot < BBOX_NUM_SLOTS )
+  {
+    if( !CAT24C512_readRecord( EEPROM_PAGE_BBOX_FIRST + mujoeBlackBox.nextSlot * BBOX_PAGES_PER_SLOT,
+                               BBOX_RECORD_KEY, (uint8 *)&hdr, sizeof( mujoeBlackBoxHdr_t ) ) )
+      break;
+    mujoeBlackBox.hdr.seq = hdr.seq + 1;
+    mujoeBlackBox.nextSlot++;
+  }
+
+  mujoeBlackBox.state = BBOX_STATE_ARMED;
+
+} // mujoeBlackBox_init
+
+// Feeds an accel sample (10-bit counts). The largest magnitude sample of each
+// BBOX_SAMPLE_PERIOD is kept so short impacts are not averaged away.
+void mujoeBlackBox_accelUpdate( int16 *pXYZ )
+{
+  uint32 mag = 0;
+  for( uint8 i = 0; i < 3; i++ )
+    mag += (int32)pXYZ[i] * pXYZ[i];
+
+  if( mag >= mujoeBlackBox.peakMag )
+  {
+    mujoeBlackBox.peakMag = mag;
+    VOID memcpy( mujoeBlackBox.peak, pXYZ, sizeof( mujoeBlackBox.peak ) );
+  }
+
+} // mujoeBlackBox_accelUpdate
+
+// Closes the current period and stores it in the ring with the given pressure (Pa),
+// vertical speed (cm/s) and fuel level (%). Call every BBOX_SAMPLE_PERIOD ms.
+// Returns TRUE once the post-trigger window is complete and the event should be
+// written with mujoeBlackBox_writeSlice.
+bool mujoeBlackBox_addSample( int32 pres, int16 vario, uint8 fuelPct )
+{
+  // Ring is frozen until the event is in EEPROM
+  if( mujoeBlackBox.state == BBOX_STATE_WRITE )
+    return FALSE;
+
+  mujoeBlackBoxSample_t *pSample = &mujoeBlackBox.ring[mujoeBlackBox.head];
+  for( uint8 i = 0; i < 3; i++ )
+  {
+    int16 val = mujoeBlackBox.peak[i] >> 2;
+    if( val > 127 ){ val = 127; }
+    if( val < -128 ){ val = -128; }
+    pSample->acc[i] = (int8)val;
+  }
+  pSample->fuelPct = fuelPct;
+  pSample->pres = (uint16)( pres >> 1 );
+  pSample->vario = vario;
+  mujoeBlackBox.peakMag = 0;
+
+  if( ++mujoeBlackBox.head == BBOX_NUM_SAMPLES )
+    mujoeBlackBox.head = 0;
+  if( mujoeBlackBox.numSamples < BBOX_NUM_SAMPLES )
+    mujoeBlackBox.numSamples++;
+
+  if( ( mujoeBlackBox.state == BBOX_STATE_POST ) && ( ++mujoeBlackBox.postCnt == BBOX_POST_SAMPLES ) )
+  {
+    // Head now points at the oldest sample
+    mujoeBlackBox.hdr.oldest = ( mujoeBlackBox.numSamples < BBOX_NUM_SAMPLES ) ? 0 : mujoeBlackBox.head;
+    mujoeBlackBox.hdr.numSamples = mujoeBlackBox.numSamples;
+    mujoeBlackBox.writeIdx = 0;
+    mujoeBlackBox.state = BBOX_STATE_WRITE;
+    return TRUE;
+  }
+
+  return FALSE;
+
+} // mujoeBlackBox_addSample
+
+// Freezes the pre-trigger window and starts the post-trigger capture. Ignored
+// while an event is being captured or once every slot is used, so stored events
+// are never overwritten.
+void mujoeBlackBox_trigger( uint32 timestamp, uint8 src )
+{
+  if( ( mujoeBlackBox.state != BBOX_STATE_ARMED ) || ( mujoeBlackBox.nextSlot >= BBOX_NUM_SLOTS ) )
+    return;
+
+  mujoeBlackBox.hdr.timestamp = timestamp;
+  mujoeBlackBox.hdr.src = src;
+  mujoeBlackBox.postCnt = 0;
+  mujoeBlackBox.state = BBOX_STATE_POST;
+
+} // mujoeBlackBox_trigger
+
+// Writes the next BBOX_WRITE_CHUNK bytes of the frozen ring, then the header
+// record that commits the event. A chunk's write cycle is left running and only
+// checked on the next call, so call no sooner than CAT24C512_WRITE_CYCLE_TIME
+// later to keep the bus free meanwhile. Returns TRUE when the event is stored or
+// was dropped on a write failure.
+bool mujoeBlackBox_writeSlice( void )
+{
+  if( mujoeBlackBox.state != BBOX_STATE_WRITE )
+    return TRUE;
+
+  if( mujoeBlackBox.writeCycle )
+  {
+    mujoeBlackBox.writeCycle = FALSE;
+    if( !CAT24C512_waitWriteCycle() )
+    {
+      mujoeBlackBox_rearm();
+      return TRUE;
+    }
+  }
+
+  uint16 slotPage = EEPROM_PAGE_BBOX_FIRST + mujoeBlackBox.nextSlot * BBOX_PAGES_PER_SLOT;
+  uint16 offset = (uint16)mujoeBlackBox.writeIdx * BBOX_WRITE_CHUNK;
+
+  if( offset < sizeof( mujoeBlackBox.ring ) )
+  {
+    uint16 len = sizeof( mujoeBlackBox.ring ) - offset;
+    if( len > BBOX_WRITE_CHUNK ){ len = BBOX_WRITE_CHUNK; }
+
+    if( !CAT24C512_writePage( slotPage + 1 + offset / CAT24C512_PAGE_SIZE,
+                              (uint8)( offset % CAT24C512_PAGE_SIZE ),
+                              (uint8 *)mujoeBlackBox.ring + offset, (uint8)len ) )
+    {
+      mujoeBlackBox_rearm();
+      return TRUE;
+    }
+
+    mujoeBlackBox.writeCycle = TRUE;
+    mujoeBlackBox.writeIdx++;
+    return FALSE;
+  }
+
+  // Samples are in, commit the event
+  if( CAT24C512_writeRecord( slotPage, BBOX_RECORD_KEY, (uint8 *)&mujoeBlackBox.hdr, sizeof( mujoeBlackBoxHdr_t ) ) )
+  {
+    mujoeBlackBox.hdr.seq++;
+    mujoeBlackBox.nextSlot++;
+  }
+
+  mujoeBlackBox_rearm();
+  return TRUE;
+
+} // mujoeBlackBox_writeSlice
+
+// Invalidates every stored event so the region can be reused
+bool mujoeBlackBox_clear( void )
+{
+  if( mujoeBlackBox.state != BBOX_STATE_ARMED )
+    return FALSE;
+
+  for( uint8 slot = 0; slot < BBOX_NUM_SLOTS; slot++ )
+  {
+    if( !CAT24C512_writeByte( EEPROM_PAGE_BBOX_FIRST + slot * BBOX_PAGES_PER_SLOT, 0, 0xFF ) ||
+        !CAT24C512_waitWriteCycle() )
+      return FALSE;
+  }
+
+  mujoeBlackBox.nextSlot = 0;
+  mujoeBlackBox.hdr.seq = 0;
+  return TRUE;
+
+} // mujoeBlackBox_clear
+
+// Returns the number of events stored
+uint8 mujoeBlackBox_getNumEvents( void )
+{
+  return mujoeBlackBox.nextSlot;
+
+} // mujoeBlackBox_getNumEvents
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Restarts the pre-trigger window from an empty ring
+static void mujoeBlackBox_rearm( void )
+{
+  mujoeBlackBox.head = 0;
+  mujoeBlackBox.numSamples = 0;
+  mujoeBlackBox.peakMag = 0;
+  mujoeBlackBox.writeCycle = FALSE;
+  mujoeBlackBox.state = BBOX_STATE_ARMED;
+
+} // mujoeBlackBox_rearm
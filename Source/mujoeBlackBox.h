@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeBlackBox.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEBLACKBOX_H
+#define MUJOEBLACKBOX_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "CAT24C512.h"
+#include "mujoeBoardConfig.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Ring sample period (ms) and depth. 40 samples = 4 s, of which
+// BBOX_POST_SAMPLES are captured after the trigger (2.4 s pre, 1.6 s post)
+#define BBOX_SAMPLE_PERIOD              100
+#define BBOX_NUM_SAMPLES                40
+#define BBOX_POST_SAMPLES               16
+
+// Bytes per EEPROM page write, must divide CAT24C512_PAGE_SIZE and fit the driver buffer
+#define BBOX_WRITE_CHUNK                32
+
+// Event slot layout: header record page followed by the sample ring pages
+#define BBOX_DATA_PAGES                 ( ( BBOX_NUM_SAMPLES * sizeof( mujoeBlackBoxSample_t ) + CAT24C512_PAGE_SIZE - 1 ) / CAT24C512_PAGE_SIZE )
+#define BBOX_PAGES_PER_SLOT             ( 1 + BBOX_DATA_PAGES )
+#define BBOX_NUM_SLOTS                  ( ( EEPROM_PAGE_BBOX_LAST - EEPROM_PAGE_BBOX_FIRST + 1 ) / BBOX_PAGES_PER_SLOT )
+
+// EEPROM record key of an event header
+#define BBOX_RECORD_KEY                 0x42
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+  BBOX_STATE_ARMED = 0,         // Filling the ring, waiting for a trigger
+  BBOX_STATE_POST,              // Triggered, filling the post-trigger window
+  BBOX_STATE_WRITE,             // Ring frozen, writing the event to EEPROM
+
+}mujoeBlackBoxState_t;
+
+typedef struct mujoeBlackBoxSample_def
+{
+  int8          acc[3];         // Largest magnitude accel sample of the period (10-bit counts / 4)
+  uint8         fuelPct;        // Fuel level (%)
+  uint16        pres;           // Pressure (Pa / 2)
+  int16         vario;          // Vertical speed (cm/s)
+
+}mujoeBlackBoxSample_t;
+
+// Stored in the first page of a slot once the samples are written, so a slot
+// without a valid header is free
+typedef struct mujoeBlackBoxHdr_def
+{
+  uint8         seq;            // Event number since the region was cleared
+  uint32        timestamp;      // Sleep timer timestamp at the triggering interrupt
+  uint8         src;            // Trigger source (MMA8453Q FF_MT_SRC)
+  uint8         oldest;         // Ring index of the oldest sample
+  uint8         numSamples;     // Valid samples, BBOX_POST_SAMPLES of them after the trigger
+
+}mujoeBlackBoxHdr_t;
+
+typedef struct mujoeBlackBox_def
+{
+  mujoeBlackBoxState_t  state;
+  mujoeBlackBoxSample_t ring[BBOX_NUM_SAMPLES];
+  uint8                 head;           // Next ring index to fill
+  uint8                 numSamples;     // Valid samples in the ring
+  uint8                 postCnt;        // Samples taken since the trigger
+  int16                 peak[3];        // Largest magnitude accel sample of the current period
+  uint32                peakMag;        // Its squared magnitude
+  mujoeBlackBoxHdr_t    hdr;            // Header of the event being captured
+  uint8                 nextSlot;       // First free slot, BBOX_NUM_SLOTS if full
+  uint8                 writeIdx;       // Next chunk to write
+  bool                  writeCycle;     // Last chunk's EEPROM write cycle not yet checked
+
+}mujoeBlackBox_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeBlackBox_init( void );
+void mujoeBlackBox_accelUpdate( int16 *pXYZ );
+bool mujoeBlackBox_addSample( int32 pres, int16 vario, uint8 fuelPct );
+void mujoeBlackBox_trigger( uint32 timestamp, uint8 src );
+bool mujoeBlackBox_writeSlice( void );
+bool mujoeBlackBox_clear( void );
+uint8 mujoeBlackBox_getNumEvents( void );
+
+#endif // MUJOEBLACKBOX_H
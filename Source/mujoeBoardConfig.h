@@ -28,6 +28,14 @@
 #define PINCFG_DISABLE_INT                0x00
 #define PINCFG_INIT_LOW                   0x00
 
+// EEPROM (CAT24C512) memory map, page addresses (128 bytes per page)
+#define EEPROM_PAGE_MS5_PROM_CACHE        0     // MS560702 PROM coefficient cache record
+#define EEPROM_PAGE_ACCEL_OFFSETS         1     // MMA8453Q OFF_X/Y/Z record
+#define EEPROM_PAGE_FUEL_TILT_COEFF       2     // Fuel level tilt correction coefficient record
+#define EEPROM_PAGE_TANK_LUT              3     // Tank capacitance to volume table record
+#define EEPROM_PAGE_BBOX_FIRST            16    // Black box event slots, protected: only mujoeBlackBox
+#define EEPROM_PAGE_BBOX_LAST             31    // writes here and it never reuses a slot until cleared
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelBurn.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeFuelBurn.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeFuelBurn_t  mujoeFuelBurn =
+{
+  .tte = FUELBURN_TTE_UNKNOWN,
+  .thresh = FUELBURN_DEFAULT_THRESH,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static void mujoeFuelBurn_estimate( void );
+static bool mujoeFuelBurn_checkThresholds( void );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Clears the regression, keeping the alert thresholds
+void mujoeFuelBurn_init( void )
+{
+  uint16 thresh[FUELBURN_NUM_THRESH];
+
+  VOID memcpy( thresh, mujoeFuelBurn.thresh, sizeof( thresh ) );
+  VOID memset( &mujoeFuelBurn, 0, sizeof( mujoeFuelBurn_t ) );
+  VOID memcpy( mujoeFuelBurn.thresh, thresh, sizeof( thresh ) );
+  mujoeFuelBurn.tte = FUELBURN_TTE_UNKNOWN;
+
+} // mujoeFuelBurn_init
+
+// Adds a level point (0.01 %), call every FUELBURN_SAMPLE_PERIOD ms. The running
+// sums are slid along with the window so each point costs the same regardless
+// of the window length. Returns TRUE when the time to empty has dropped below
+// another alert threshold.
+bool mujoeFuelBurn_update( int16 lvl )
+{
+  mujoeFuelBurn.lvl = lvl;
+
+  if( mujoeFuelBurn.n < FUELBURN_WINDOW_LEN )
+  {
+    // Growing, the new point takes x = n
+    mujoeFuelBurn.window[mujoeFuelBurn.n] = lvl;
+    mujoeFuelBurn.sumXY += (int32)mujoeFuelBurn.n * lvl;
+    mujoeFuelBurn.sumY += lvl;
+    mujoeFuelBurn.n++;
+  }
+  else
+  {
+    // Sliding, the oldest point drops out and every other x steps down by one
+    int16 oldest = mujoeFuelBurn.window[mujoeFuelBurn.head];
+    mujoeFuelBurn.sumXY += (int32)( FUELBURN_WINDOW_LEN - 1 ) * lvl - ( mujoeFuelBurn.sumY - oldest );
+    mujoeFuelBurn.sumY += lvl - oldest;
+    mujoeFuelBurn.window[mujoeFuelBurn.head] = lvl;
+    if( ++mujoeFuelBurn.head == FUELBURN_WINDOW_LEN )
+      mujoeFuelBurn.head = 0;
+  }
+
+  mujoeFuelBurn_estimate();
+  return mujoeFuelBurn_checkThresholds();
+
+} // mujoeFuelBurn_update
+
+// Returns the burn rate (0.01 %/h), positive while burning
+int16 mujoeFuelBurn_getRate( void )
+{
+  return mujoeFuelBurn.rate;
+
+} // mujoeFuelBurn_getRate
+
+// Returns the predicted time to empty (min), FUELBURN_TTE_UNKNOWN if not burning
+uint16 mujoeFuelBurn_getTte( void )
+{
+  return mujoeFuelBurn.tte;
+
+} // mujoeFuelBurn_getTte
+
+// Returns the number of alert thresholds the time to empty is below
+uint8 mujoeFuelBurn_getAlertLvl( void )
+{
+  return mujoeFuelBurn.alertLvl;
+
+} // mujoeFuelBurn_getAlertLvl
+
+// Sets the FUELBURN_NUM_THRESH alert thresholds (min), which must be descending
+bool mujoeFuelBurn_setThresholds( uint16 *pThresh )
+{
+  for( uint8 i = 1; i < FUELBURN_NUM_THRESH; i++ )
+  {
+    if( pThresh[i] >= pThresh[i - 1] )
+      return FALSE;
+  }
+
+  VOID memcpy( mujoeFuelBurn.thresh, pThresh, sizeof( mujoeFuelBurn.thresh ) );
+  mujoeFuelBurn.alertLvl = 0;
+  return TRUE;
+
+} // mujoeFuelBurn_setThresholds
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Least squares slope over the window, x in sample periods:
+// slope = ( n * Sxy - Sx * Sy ) / ( n * Sxx - Sx^2 ), where Sx and Sxx of
+// x = 0 .. n-1 are closed form
+static void mujoeFuelBurn_estimate( void )
+{
+  int32 n = mujoeFuelBurn.n;
+
+  if( n < FUELBURN_MIN_POINTS )
+  {
+    mujoeFuelBurn.rate = 0;
+    mujoeFuelBurn.tte = FUELBURN_TTE_UNKNOWN;
+    return;
+  }
+
+  int32 sx = n * ( n - 1 ) / 2;
+  int32 sxx = ( n - 1 ) * n * ( 2 * n - 1 ) / 6;
+  int32 num = n * mujoeFuelBurn.sumXY - sx * mujoeFuelBurn.sumY;
+  int32 den = n * sxx - sx * sx;
+
+  if( num > FUELBURN_MAX_NUM ){ num = FUELBURN_MAX_NUM; }
+  if( num < -FUELBURN_MAX_NUM ){ num = -FUELBURN_MAX_NUM; }
+
+  // Per sample period -> per hour, sign flipped so burning is positive
+  int32 rate = -( num * ( 3600000L / FUELBURN_SAMPLE_PERIOD ) ) / den;
+  if( rate > 0x7FFF ){ rate = 0x7FFF; }
+  if( rate < -0x7FFF ){ rate = -0x7FFF; }
+  mujoeFuelBurn.rate = (int16)rate;
+
+  if( ( rate <= 0 ) || ( mujoeFuelBurn.lvl <= 0 ) )
+  {
+    mujoeFuelBurn.tte = ( mujoeFuelBurn.lvl <= 0 ) ? 0 : FUELBURN_TTE_UNKNOWN;
+    return;
+  }
+
+  int32 tte = ( (int32)mujoeFuelBurn.lvl * 60 ) / rate;
+  mujoeFuelBurn.tte = ( tte >= FUELBURN_TTE_UNKNOWN ) ? ( FUELBURN_TTE_UNKNOWN - 1 ) : (uint16)tte;
+
+} // mujoeFuelBurn_estimate
+
+// Steps the alert level down through each threshold the prediction has fallen
+// below, and back up once it recovers past a threshold plus the hysteresis
+static bool mujoeFuelBurn_checkThresholds( void )
+{
+  uint16 tte = mujoeFuelBurn.tte;
+  bool crossed = FALSE;
+
+  while( ( mujoeFuelBurn.alertLvl < FUELBURN_NUM_THRESH ) &&
+         ( tte < mujoeFuelBurn.thresh[mujoeFuelBurn.alertLvl] ) )
+  {
+    mujoeFuelBurn.alertLvl++;
+    crossed = TRUE;
+  }
+
+  while( ( mujoeFuelBurn.alertLvl > 0 ) &&
+         ( (uint32)tte >= (uint32)mujoeFuelBurn.thresh[mujoeFuelBurn.alertLvl - 1] + FUELBURN_THRESH_HYST ) )
+    mujoeFuelBurn.alertLvl--;
+
+  return crossed;
+
+} // mujoeFuelBurn_checkThresholds
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelBurn.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEFUELBURN_H
+#define MUJOEFUELBURN_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "string.h"             // for memset, memcpy
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Regression points are taken every FUELBURN_SAMPLE_PERIOD ms over a sliding
+// window of FUELBURN_WINDOW_LEN points, 30 x 10 s = 5 min
+#define FUELBURN_SAMPLE_PERIOD          10000
+#define FUELBURN_WINDOW_LEN             30
+
+// Points needed before a burn rate is published
+#define FUELBURN_MIN_POINTS             6
+
+// Bound on the regression numerator so the rate scaling cannot overflow.
+// Well above any real burn rate (~250 %/h).
+#define FUELBURN_MAX_NUM                5000000L
+
+// Time to empty when not burning or not yet known
+#define FUELBURN_TTE_UNKNOWN            0xFFFF
+
+// Time to empty alert thresholds (min), in descending order, and the margin
+// (min) the prediction must recover by before a threshold re-arms
+#define FUELBURN_NUM_THRESH             3
+#define FUELBURN_DEFAULT_THRESH         { 30, 15, 5 }
+#define FUELBURN_THRESH_HYST            2
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct mujoeFuelBurn_def
+{
+  int16         window[FUELBURN_WINDOW_LEN];    // Regression points (0.01 %), oldest at head once full
+  uint8         head;                           // Oldest point once the window is full
+  uint8         n;                              // Points in the window
+  int32         sumY;                           // Sum of y
+  int32         sumXY;                          // Sum of x * y, x = 0 for the oldest point
+  int16         lvl;                            // Latest level (0.01 %)
+  int16         rate;                           // Burn rate (0.01 %/h), positive while burning
+  uint16        tte;                            // Time to empty (min)
+  uint16        thresh[FUELBURN_NUM_THRESH];    // Alert thresholds (min), descending
+  uint8         alertLvl;                       // Number of thresholds the prediction is below
+
+}mujoeFuelBurn_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeFuelBurn_init( void );
+bool mujoeFuelBurn_update( int16 lvl );
+int16 mujoeFuelBurn_getRate( void );
+uint16 mujoeFuelBurn_getTte( void );
+uint8 mujoeFuelBurn_getAlertLvl( void );
+bool mujoeFuelBurn_setThresholds( uint16 *pThresh );
+
+#endif // MUJOEFUELBURN_H
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelCap.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeFuelCap.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeFuelCap_t   mujoeFuelCap =
+{
+  .active = FALSE,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Starts a capture, sample timestamps are relative to "timestamp" (sleep timer)
+void mujoeFuelCap_start( uint32 timestamp )
+{
+  VOID memset( &mujoeFuelCap, 0, sizeof( mujoeFuelCap_t ) );
+  mujoeFuelCap.startTime = timestamp;
+  mujoeFuelCap.active = TRUE;
+
+} // mujoeFuelCap_start
+
+// Stops the capture. A partly filled frame is discarded.
+void mujoeFuelCap_stop( void )
+{
+  mujoeFuelCap.active = FALSE;
+  mujoeFuelCap.pending = FALSE;
+
+} // mujoeFuelCap_stop
+
+bool mujoeFuelCap_isActive( void )
+{
+  return mujoeFuelCap.active;
+
+} // mujoeFuelCap_isActive
+
+// Packs a sample taken at "timestamp" (sleep timer). Returns TRUE when it
+// completes a frame that is now waiting for mujoeFuelCap_getFrame. A frame that
+// completes while the previous one is still unsent is dropped.
+bool mujoeFuelCap_addSample( uint32 timestamp, uint16 capRaw, uint16 capAlgo )
+{
+  if( !mujoeFuelCap.active )
+    return FALSE;
+
+  uint8 *pFrame = mujoeFuelCap.frame[mujoeFuelCap.fillIdx];
+  uint8 *pSample = &pFrame[FUELCAP_SAMPLE_IDX + mujoeFuelCap.numSamples * FUELCAP_SAMPLE_LEN];
+  uint16 ts = (uint16)mujoeTimestamp_toMs( timestamp - mujoeFuelCap.startTime );
+
+  pSample[0] = HI_UINT16( ts );
+  pSample[1] = LO_UINT16( ts );
+  pSample[2] = HI_UINT16( capRaw );
+  pSample[3] = LO_UINT16( capRaw );
+  pSample[4] = HI_UINT16( capAlgo );
+  pSample[5] = LO_UINT16( capAlgo );
+
+  if( ++mujoeFuelCap.numSamples < FUELCAP_SAMPLES_PER_FRAME )
+    return FALSE;
+
+  mujoeFuelCap.numSamples = 0;
+  if( mujoeFuelCap.pending )
+  {
+    mujoeFuelCap.drops += FUELCAP_SAMPLES_PER_FRAME;
+    return FALSE;
+  }
+
+  pFrame[FUELCAP_SEQ_IDX] = mujoeFuelCap.seq++;
+  pFrame[FUELCAP_DROP_IDX] = (uint8)mujoeFuelCap.drops;
+  mujoeFuelCap.fillIdx ^= 1;
+  mujoeFuelCap.pending = TRUE;
+  return TRUE;
+
+} // mujoeFuelCap_addSample
+
+// Returns the completed frame (FUELCAP_FRAME_LEN bytes), NULL if none is waiting
+uint8 *mujoeFuelCap_getFrame( void )
+{
+  return mujoeFuelCap.pending ? mujoeFuelCap.frame[mujoeFuelCap.fillIdx ^ 1] : NULL;
+
+} // mujoeFuelCap_getFrame
+
+// Frees the frame from mujoeFuelCap_getFrame, its samples count as dropped if
+// it could not be sent
+void mujoeFuelCap_releaseFrame( bool sent )
+{
+  if( !mujoeFuelCap.pending )
+    return;
+
+  if( !sent )
+    mujoeFuelCap.drops += FUELCAP_SAMPLES_PER_FRAME;
+  mujoeFuelCap.pending = FALSE;
+
+} // mujoeFuelCap_releaseFrame
+
+// Returns the samples dropped since capture start
+uint16 mujoeFuelCap_getDrops( void )
+{
+  return mujoeFuelCap.drops;
+
+} // mujoeFuelCap_getDrops
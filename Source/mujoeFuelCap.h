@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelCap.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEFUELCAP_H
+#define MUJOEFUELCAP_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "hal_defs.h"           // for HI_UINT16, LO_UINT16
+#include "mujoeTimestamp.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Capture frame, sent in place of the Async Bulk packet (same length, MSB first)
+#define FUELCAP_FRAME_LEN               20
+#define FUELCAP_SEQ_IDX                 0     // uint8: Frame counter
+#define FUELCAP_DROP_IDX                1     // uint8: Samples dropped since capture start (wraps)
+#define FUELCAP_SAMPLE_IDX              2     // First sample
+
+// Sample: uint16 timestamp (ms since capture start, wraps), uint16 raw
+// capacitance, uint16 tracking algo capacitance
+#define FUELCAP_SAMPLE_LEN              6
+#define FUELCAP_SAMPLES_PER_FRAME       ( ( FUELCAP_FRAME_LEN - FUELCAP_SAMPLE_IDX ) / FUELCAP_SAMPLE_LEN )
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+// One frame fills while the other waits to be sent
+typedef struct mujoeFuelCap_def
+{
+  bool          active;
+  uint8         frame[2][FUELCAP_FRAME_LEN];
+  uint8         fillIdx;                // Frame being filled
+  uint8         numSamples;             // Samples in the frame being filled
+  bool          pending;                // Other frame is complete and not yet sent
+  uint8         seq;                    // Sequence number of the next frame
+  uint16        drops;                  // Samples dropped since capture start
+  uint32        startTime;              // Sleep timer timestamp at capture start
+
+}mujoeFuelCap_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeFuelCap_start( uint32 timestamp );
+void mujoeFuelCap_stop( void );
+bool mujoeFuelCap_isActive( void );
+bool mujoeFuelCap_addSample( uint32 timestamp, uint16 capRaw, uint16 capAlgo );
+uint8 *mujoeFuelCap_getFrame( void );
+void mujoeFuelCap_releaseFrame( bool sent );
+uint16 mujoeFuelCap_getDrops( void );
+
+#endif // MUJOEFUELCAP_H
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelEst.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeFuelEst.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeFuelEst_t   mujoeFuelEst =
+{
+  .cnt = 0,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static int16 mujoeFuelEst_median( void );
+static uint8 mujoeFuelEst_loadShift( uint16 activity );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeFuelEst_init( void )
+{
+  VOID memset( &mujoeFuelEst, 0, sizeof( mujoeFuelEst_t ) );
+
+} // mujoeFuelEst_init
+
+// Feeds a fuel level sample (0.01 %) along with the accelerometer activity at the
+// time it was taken. Slosh spikes are dropped by the median and what is left is
+// smoothed harder the more the frame is being shaken.
+void mujoeFuelEst_update( int16 lvl, uint16 activity )
+{
+  mujoeFuelEst.window[mujoeFuelEst.idx] = lvl;
+  if( ++mujoeFuelEst.idx == FUELEST_MEDIAN_LEN )
+    mujoeFuelEst.idx = 0;
+
+  // Pass samples through with no confidence until the window is full, then
+  // seed from its median
+  if( mujoeFuelEst.cnt < FUELEST_MEDIAN_LEN )
+  {
+    if( ++mujoeFuelEst.cnt < FUELEST_MEDIAN_LEN )
+    {
+      mujoeFuelEst.lvl = (int32)lvl << FUELEST_Q;
+      mujoeFuelEst.conf = 0;
+      return;
+    }
+    mujoeFuelEst.lvl = (int32)mujoeFuelEst_median() << FUELEST_Q;
+  }
+
+  int32 med = (int32)mujoeFuelEst_median() << FUELEST_Q;
+  mujoeFuelEst.shift = mujoeFuelEst_loadShift( activity );
+  mujoeFuelEst.lvl += ( med - mujoeFuelEst.lvl ) >> mujoeFuelEst.shift;
+
+  int32 res = ( med - mujoeFuelEst.lvl ) >> FUELEST_Q;
+  if( res < 0 ){ res = -res; }
+  if( res > 0xFFFF ){ res = 0xFFFF; }
+  mujoeFuelEst.dev = mujoeFuelEst.dev - ( mujoeFuelEst.dev >> FUELEST_DEV_SHIFT ) + 
+                     ( (uint16)res >> FUELEST_DEV_SHIFT );
+
+  int16 conf = (int16)( ( 100L * FUELEST_DEV_REF ) / ( FUELEST_DEV_REF + mujoeFuelEst.dev ) ) -
+               ( mujoeFuelEst.shift - FUELEST_SHIFT_MIN ) * FUELEST_LOAD_PENALTY;
+  mujoeFuelEst.conf = ( conf > 0 ) ? (uint8)conf : 0;
+
+} // mujoeFuelEst_update
+
+// Returns the level estimate (0.01 %)
+int16 mujoeFuelEst_getLevel( void )
+{
+  return (int16)( ( mujoeFuelEst.lvl + ( 1 << ( FUELEST_Q - 1 ) ) ) >> FUELEST_Q );
+
+} // mujoeFuelEst_getLevel
+
+// Returns the confidence in the level estimate (0 to 100 %)
+uint8 mujoeFuelEst_getConfidence( void )
+{
+  return mujoeFuelEst.conf;
+
+} // mujoeFuelEst_getConfidence
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Median of the window by insertion sort of a copy, fixed cost for the fixed window
+static int16 mujoeFuelEst_median( void )
+{
+  int16 sorted[FUELEST_MEDIAN_LEN];
+
+  for( uint8 i = 0; i < FUELEST_MEDIAN_LEN; i++ )
+  {
+    int16 val = mujoeFuelEst.window[i];
+    uint8 j = i;
+    while( ( j > 0 ) && ( sorted[j - 1] > val ) )
+    {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = val;
+  }
+
+  return sorted[FUELEST_MEDIAN_LEN / 2];
+
+} // mujoeFuelEst_median
+
+// Maps accelerometer activity to the IIR shift, one step per 4x above FUELEST_ACT_BASE
+static uint8 mujoeFuelEst_loadShift( uint16 activity )
+{
+  uint8 shift = FUELEST_SHIFT_MIN;
+  uint16 act = activity / FUELEST_ACT_BASE;
+
+  while( act && ( shift < FUELEST_SHIFT_MAX ) )
+  {
+    act >>= 2;
+    shift++;
+  }
+
+  return shift;
+
+} // mujoeFuelEst_loadShift
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelEst.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEFUELEST_H
+#define MUJOEFUELEST_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Spike rejecting median window (samples), must be odd
+#define FUELEST_MEDIAN_LEN              5
+
+// Fractional bits carried by the level estimate
+#define FUELEST_Q                       8
+
+// IIR alpha = 1/2^N. N is FUELEST_SHIFT_MIN at rest and grows by one for every
+// 4x of accelerometer activity above FUELEST_ACT_BASE, up to FUELEST_SHIFT_MAX
+#define FUELEST_SHIFT_MIN               2
+#define FUELEST_SHIFT_MAX               7
+#define FUELEST_ACT_BASE                64      // Activity (2g counts^2) ~= 0.03 g rms
+
+// Residual (median vs estimate) EWMA, alpha = 1/2^N
+#define FUELEST_DEV_SHIFT               3
+
+// Confidence is 100 % * FUELEST_DEV_REF / ( FUELEST_DEV_REF + dev ), less
+// FUELEST_LOAD_PENALTY % per IIR shift step above FUELEST_SHIFT_MIN
+#define FUELEST_DEV_REF                 100     // 0.01 %
+#define FUELEST_LOAD_PENALTY            8
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct mujoeFuelEst_def
+{
+  int16         window[FUELEST_MEDIAN_LEN];     // Last samples (0.01 %), oldest overwritten
+  uint8         idx;                            // Next window slot
+  uint8         cnt;                            // Samples in the window
+  int32         lvl;                            // Level estimate (0.01 %, Q8)
+  uint16        dev;                            // Mean abs residual (0.01 %)
+  uint8         shift;                          // IIR shift used for the last sample
+  uint8         conf;                           // Confidence (%)
+
+}mujoeFuelEst_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeFuelEst_init( void );
+void mujoeFuelEst_update( int16 lvl, uint16 activity );
+int16 mujoeFuelEst_getLevel( void );
+uint8 mujoeFuelEst_getConfidence( void );
+
+#endif // MUJOEFUELEST_H
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelTilt.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeFuelTilt.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeFuelTilt_t  mujoeFuelTilt = 
+{
+  .haveLvl = FALSE,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static bool mujoeFuelTilt_calcSines( int16 *pGrav, int16 *pSinX, int16 *pSinY );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// pCoeff = NULL starts with no correction, i.e. the raw level passes through
+void mujoeFuelTilt_init( mujoeFuelTiltCoeff_t *pCoeff )
+{
+  VOID memset( &mujoeFuelTilt, 0, sizeof( mujoeFuelTilt_t ) );
+  
+  if( pCoeff != NULL )
+    mujoeFuelTilt_setCoeff( pCoeff );
+  
+} // mujoeFuelTilt_init
+
+void mujoeFuelTilt_setCoeff( mujoeFuelTiltCoeff_t *pCoeff )
+{
+  VOID memcpy( &mujoeFuelTilt.coeff, pCoeff, sizeof( mujoeFuelTiltCoeff_t ) );
+  
+} // mujoeFuelTilt_setCoeff
+
+void mujoeFuelTilt_getCoeff( mujoeFuelTiltCoeff_t *pCoeff )
+{
+  VOID memcpy( pCoeff, &mujoeFuelTilt.coeff, sizeof( mujoeFuelTiltCoeff_t ) );
+  
+} // mujoeFuelTilt_getCoeff
+
+// Takes the current gravity vector (counts) as the level attitude reference
+void mujoeFuelTilt_setLevelRef( int16 *pGrav )
+{
+  int16 sinX, sinY;
+  if( mujoeFuelTilt_calcSines( pGrav, &sinX, &sinY ) )
+  {
+    mujoeFuelTilt.coeff.refX = sinX;
+    mujoeFuelTilt.coeff.refY = sinY;
+  }
+  
+} // mujoeFuelTilt_setLevelRef
+
+// Returns the tilt corrected fuel level (0.01 %) for a raw level "lvl" (0.01 %)
+// read while the gravity vector was "pGrav" (counts). While tilted past the
+// model's range the last corrected level is held instead.
+int16 mujoeFuelTilt_correct( int16 lvl, int16 *pGrav )
+{
+  int16 sinX, sinY;
+  if( !mujoeFuelTilt_calcSines( pGrav, &sinX, &sinY ) )
+    return mujoeFuelTilt.haveLvl ? mujoeFuelTilt.lastLvl : lvl;
+  
+  int32 dX = (int32)sinX - mujoeFuelTilt.coeff.refX;
+  int32 dY = (int32)sinY - mujoeFuelTilt.coeff.refY;
+  int32 dXX = ( dX * dX ) >> FUELTILT_Q;
+  int32 dYY = ( dY * dY ) >> FUELTILT_Q;
+  
+  if( ( dXX + dYY ) > FUELTILT_MAX_TILT_SQ )
+    return mujoeFuelTilt.haveLvl ? mujoeFuelTilt.lastLvl : lvl;
+  
+  int32 err = ( ( mujoeFuelTilt.coeff.kX * dX ) >> FUELTILT_Q ) +
+              ( ( mujoeFuelTilt.coeff.kY * dY ) >> FUELTILT_Q ) +
+              ( ( mujoeFuelTilt.coeff.kXX * dXX ) >> FUELTILT_Q ) +
+              ( ( mujoeFuelTilt.coeff.kYY * dYY ) >> FUELTILT_Q );
+  
+  int32 corr = (int32)lvl - err;
+  if( corr < 0 ){ corr = 0; }
+  if( corr > FUELTILT_LVL_MAX ){ corr = FUELTILT_LVL_MAX; }
+  
+  mujoeFuelTilt.lastLvl = (int16)corr;
+  mujoeFuelTilt.haveLvl = TRUE;
+  return mujoeFuelTilt.lastLvl;
+  
+} // mujoeFuelTilt_correct
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Normalises the X and Y gravity components to sines of pitch and roll (Q14).
+// Returns FALSE if the gravity vector is not valid yet.
+static bool mujoeFuelTilt_calcSines( int16 *pGrav, int16 *pSinX, int16 *pSinY )
+{
+  uint32 magSq = (int32)pGrav[0] * pGrav[0] + (int32)pGrav[1] * pGrav[1] + (int32)pGrav[2] * pGrav[2];
+  uint16 mag = mujoeToolBox_isqrt32( magSq );
+  if( mag == 0 )
+    return FALSE;
+  
+  *pSinX = (int16)( ( (int32)pGrav[0] << FUELTILT_Q ) / mag );
+  *pSinY = (int16)( ( (int32)pGrav[1] << FUELTILT_Q ) / mag );
+  return TRUE;
+  
+} // mujoeFuelTilt_calcSines
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeFuelTilt.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEFUELTILT_H
+#define MUJOEFUELTILT_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "mujoeToolBox.h"
+#include "string.h"             // for memcpy
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Fractional bits of the tilt sines and reference direction
+#define FUELTILT_Q                      14
+
+// Beyond this tilt (sum of squared sines, Q14) the model is not trusted and the
+// last corrected level is held. 5400 ~= 35 deg
+#define FUELTILT_MAX_TILT_SQ            5400
+
+// Fuel level bounds (0.01 %)
+#define FUELTILT_LVL_MAX                10000
+
+// EEPROM record key of the coefficient set
+#define FUELTILT_RECORD_KEY             0x54
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+// Per tank correction: dLvl = kX * dX + kY * dY + kXX * dX^2 + kYY * dY^2
+// where dX, dY are the pitch and roll sines relative to the level reference.
+// The quadratic terms model a probe that sits off the tank's tilt axis.
+typedef struct mujoeFuelTiltCoeff_def
+{
+  int16         refX;           // Gravity X component at level attitude (Q14 of |g|)
+  int16         refY;           // Gravity Y component at level attitude (Q14 of |g|)
+  int16         kX;             // Level error per unit pitch sine (0.01 %)
+  int16         kY;             // Level error per unit roll sine (0.01 %)
+  int16         kXX;            // Level error per unit pitch sine squared (0.01 %)
+  int16         kYY;            // Level error per unit roll sine squared (0.01 %)
+
+}mujoeFuelTiltCoeff_t;
+
+typedef struct mujoeFuelTilt_def
+{
+  mujoeFuelTiltCoeff_t  coeff;
+  bool                  haveLvl;        // TRUE once lastLvl is valid
+  int16                 lastLvl;        // Last corrected level (0.01 %)
+
+}mujoeFuelTilt_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeFuelTilt_init( mujoeFuelTiltCoeff_t *pCoeff );
+void mujoeFuelTilt_setCoeff( mujoeFuelTiltCoeff_t *pCoeff );
+void mujoeFuelTilt_getCoeff( mujoeFuelTiltCoeff_t *pCoeff );
+void mujoeFuelTilt_setLevelRef( int16 *pGrav );
+int16 mujoeFuelTilt_correct( int16 lvl, int16 *pGrav );
+
+#endif // MUJOEFUELTILT_H
@@ -17,11 +17,14 @@ typedef struct
 {
   gpioPin_t        *pGpioPinTbl;        // Pointer to GPIO cfg table
   osalEvt_t        intMgrEvt;           // OSAL event assigned to muJoeGPIO_interruptMgr    
+  bool             inCb;                // TRUE while muJoeGPIO_interruptMgr runs a callback
+  uint32           cbTimestamp;         // Edge timestamp of the callback being run
 }mueJoeGPIO_t;
 
 typedef struct gpioIntSrc_def
 {
   uint8         pxInts[3];      // Index 0 = Port 0, Index 1 = Port 1, Index 2 = Port 2
+  uint32        pinTs[3][8];    // Sleep timer timestamp of each pin's latest interrupt, [port][pin]
   
 }gpioIntSrc_t;
 
@@ -45,6 +48,7 @@ static bool muJoeGPIO_cfgPin( gpioPin_t gpioPin );
 volatile static gpioIntSrc_t    gpioIntSrc = 
 {
   .pxInts = {0},
+  .pinTs = {{0}},
 };
 // END TEST
 
@@ -53,6 +57,8 @@ static mueJoeGPIO_t     mueJoeGPIO =
   .pGpioPinTbl = NULL,       
   .intMgrEvt.taskId = 0,
   .intMgrEvt.event = 0,
+  .inCb = FALSE,
+  .cbTimestamp = 0,
 };
 
 //static gpioPin_t        *pGpioPinTbl = NULL;    // Local ptr to pin config table defined in mujoeBoardConfig.c
@@ -160,10 +166,17 @@ void muJoeGPIO_interruptMgr( void )
             {
                 if( mueJoeGPIO.pGpioPinTbl[k].IntCb != NULL )
                 {
+                  // Clear interrupt flag for respective port and pin before the
+                  // callback, so an edge arriving while it runs is not lost
+                  halIntState_t intState;
+                  HAL_ENTER_CRITICAL_SECTION( intState );
+                  gpioIntSrc.pxInts[port] &= ~( 0x01 << pin );
+                  mueJoeGPIO.cbTimestamp = gpioIntSrc.pinTs[port][pin];
+                  HAL_EXIT_CRITICAL_SECTION( intState );
                   // Call callback fnc
+                  mueJoeGPIO.inCb = TRUE;
                   mueJoeGPIO.pGpioPinTbl[k].IntCb();
-                  // Clear interrupt flag for respective port and pin
-                  gpioIntSrc.pxInts[port] &= ~( 0x01 << pin );
+                  mueJoeGPIO.inCb = FALSE;
                 }
                 break;
             }
@@ -174,6 +187,17 @@ void muJoeGPIO_interruptMgr( void )
   
 } // muJoeGPIO_interruptMgr
 
+// Returns the sleep timer timestamp of the edge whose callback is running, taken
+// on ISR entry, or the current time outside a callback (e.g. a callback called
+// directly to service a missed edge). Each pin keeps its own stamp. A second
+// edge on the same pin before its callback runs restamps it, which matches the
+// data: the part has overwritten the first sample with the one read.
+uint32 muJoeGPIO_getEdgeTimestamp( void )
+{
+  return mueJoeGPIO.inCb ? mueJoeGPIO.cbTimestamp : mujoeTimestamp_now();
+  
+} // muJoeGPIO_getEdgeTimestamp
+
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
@@ -295,16 +319,99 @@ static bool muJoeGPIO_cfgPin( gpioPin_t gpioPin )
 // INTERRUPT SERVICE ROUTINES
 ////////////////////////////////////////////////////////////////////////////////
 
+// PORT 0 ISR //////////////////////////////////////////////////////////////////
+HAL_ISR_FUNCTION( PORT0_ISR , P0INT_VECTOR )
+{
+  HAL_ENTER_ISR();
+  
+  uint32 timestamp = mujoeTimestamp_now();
+  
+  // P0.0
+  if( P0IFG & 0x01 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x01;
+     gpioIntSrc.pinTs[0][0] = timestamp;
+     P0IFG = ~0x01; 
+  }
+  
+  // P0.1
+  if( P0IFG & 0x02 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x02;
+     gpioIntSrc.pinTs[0][1] = timestamp;
+     P0IFG = ~0x02; 
+  }
+  
+  // P0.2
+  if( P0IFG & 0x04 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x04;
+     gpioIntSrc.pinTs[0][2] = timestamp;
+     P0IFG = ~0x04; 
+  }
+  
+  // P0.3
+  if( P0IFG & 0x08 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x08;
+     gpioIntSrc.pinTs[0][3] = timestamp;
+     P0IFG = ~0x08; 
+  }
+  
+  // P0.4
+  if( P0IFG & 0x10 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x10;
+     gpioIntSrc.pinTs[0][4] = timestamp;
+     P0IFG = ~0x10; 
+  }
+  
+  // P0.5
+  if( P0IFG & 0x20 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x20;
+     gpioIntSrc.pinTs[0][5] = timestamp;
+     P0IFG = ~0x20; 
+  }
+  
+  // P0.6
+  if( P0IFG & 0x40 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x40;
+     gpioIntSrc.pinTs[0][6] = timestamp;
+     P0IFG = ~0x40; 
+  }
+  
+  // P0.7
+  if( P0IFG & 0x80 )
+  {
+     gpioIntSrc.pxInts[0] |= 0x80;
+     gpioIntSrc.pinTs[0][7] = timestamp;
+     P0IFG = ~0x80; 
+  }
+  
+  // Notify app of interrupt
+  if( mueJoeGPIO.intMgrEvt.taskId )
+    osal_set_event( mueJoeGPIO.intMgrEvt.taskId, mueJoeGPIO.intMgrEvt.event );
+  
+  P0IF = 0;                                                                     // Clear Port 0 flag in Interrupt Flags 4 SFR
+  HAL_EXIT_ISR();
+  return;
+}
+
 // PORT 1 ISR //////////////////////////////////////////////////////////////////
 HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
 //HAL_ISR_FUNCTION( PORT1_ISR , PORT1_VECTOR )  // DEFAULT
 {
   HAL_ENTER_ISR();
   
+  uint32 timestamp = mujoeTimestamp_now();
+  
   // P1.0
   if( P1IFG & 0x01 )                        
   { 
      gpioIntSrc.pxInts[1] |= 0x01;
+     gpioIntSrc.pinTs[1][0] = timestamp;
      P1IFG = ~0x01;            // Clear P1.0 Source Interrupt Flag. Note register has R/W0 access , i.e. writing ones to bits does not do anything                          
   }
   
@@ -312,6 +419,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x02 )
   {
      gpioIntSrc.pxInts[1] |= 0x02;
+     gpioIntSrc.pinTs[1][1] = timestamp;
      P1IFG = ~0x02; 
   }
   
@@ -319,6 +427,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x04 )
   {
      gpioIntSrc.pxInts[1] |= 0x04;
+     gpioIntSrc.pinTs[1][2] = timestamp;
      P1IFG = ~0x04; 
   }
   
@@ -326,6 +435,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x08 )
   {
      gpioIntSrc.pxInts[1] |= 0x08;
+     gpioIntSrc.pinTs[1][3] = timestamp;
      P1IFG = ~0x08; 
   }
   
@@ -333,6 +443,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x10 )
   {
      gpioIntSrc.pxInts[1] |= 0x10;
+     gpioIntSrc.pinTs[1][4] = timestamp;
      P1IFG = ~0x10; 
   }
   
@@ -340,6 +451,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x20 )
   {
      gpioIntSrc.pxInts[1] |= 0x20;
+     gpioIntSrc.pinTs[1][5] = timestamp;
      P1IFG = ~0x20; 
   }
   
@@ -347,6 +459,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x40 )
   {
      gpioIntSrc.pxInts[1] |= 0x40;
+     gpioIntSrc.pinTs[1][6] = timestamp;
      P1IFG = ~0x40; 
   }
   
@@ -354,6 +467,7 @@ HAL_ISR_FUNCTION( PORT1_ISR , P1INT_VECTOR )    // TEST
   if( P1IFG & 0x80 )
   {
      gpioIntSrc.pxInts[1] |= 0x80;
+     gpioIntSrc.pinTs[1][7] = timestamp;
      P1IFG = ~0x80; 
   }
   
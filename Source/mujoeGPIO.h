@@ -14,6 +14,7 @@
 #include "hal_mcu.h"
 #include "mujoeBoardConfig.h"
 #include "mujoeToolBox.h"
+#include "mujoeTimestamp.h"
 //#include "string.h"     // For memcpy
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +85,7 @@
 void muJoeGPIO_assignIntMgrOSALEvt( uint8 taskId, uint16 event );
 bool muJoeGPIO_registerIntCallback( mujoegpio_pinid_t pinId, pinIntCb_t cb );
 void muJoeGPIO_interruptMgr( void );
+uint32 muJoeGPIO_getEdgeTimestamp( void );
 bool muJoeGPIO_togglePin( mujoegpio_pinid_t pinId );
 bool muJoeGPIO_writePin( mujoegpio_pinid_t pinId, bool high );
 int8 muJoeGPIO_readPin( mujoegpio_pinid_t pinId );
@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "muJoeGenericProfileMgr.h"
+#include "sensorMgrTask.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // LOCAL VARS 
@@ -22,8 +23,14 @@ static muJoeGenMgr_t           muJoeGenMgr;
 static void issueResponse( uint16 rspCode );
 static uint16 cmdGroup_sysGrp( uint8 cmd_id );
 static uint16 cmdGroup_datGrp( uint8 cmd_id );
+static uint16 cmdGroup_calGrp( uint8 cmd_id );
 
 static bStatus_t getAsyncSamplePeriod( uint32 *pSampPeriod );
+static bStatus_t getFuelTiltCoeff( mujoeFuelTiltCoeff_t *pCoeff );
+static bStatus_t getFuelTteThresh( uint16 *pThresh );
+static bStatus_t getTankCalVolume( uint16 *pVol );
+static bStatus_t getFuelCritThresh( uint8 *pThresh );
+static bStatus_t getOpProfile( uint8 *pSel );
 
 ////////////////////////////////////////////////////////////////////////////////
 // API FUNCTIONS
@@ -61,6 +68,9 @@ bStatus_t muJoeGenMgr_cmdWriteHandler( void )
     case MUJOE_CMD_GRP_DAT:
       rspVal = cmdGroup_datGrp( cmd_id );
       break;
+    case MUJOE_CMD_GRP_CAL:
+      rspVal = cmdGroup_calGrp( cmd_id );
+      break;
     // Unsupported Command Group
     default:
       rspVal = MUJOE_RSP_INV_CMD_GRP;
@@ -73,6 +83,13 @@ bStatus_t muJoeGenMgr_cmdWriteHandler( void )
   return bStatus;
 }
 
+// Sends an unsolicited code on the Response characteristic
+void muJoeGenMgr_issueNotification( uint16 notiCode )
+{
+  issueResponse( notiCode );
+  
+} // muJoeGenMgr_issueNotification
+
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +111,13 @@ static uint16 cmdGroup_sysGrp( uint8 cmd_id )
     case MUJOE_GRP_SYS_ID_PWRDWN:
       // Call fnc that powers down board
       break;
+    case MUJOE_GRP_SYS_ID_OPPROFILE:
+    {
+      uint8 sel;
+      if( ( getOpProfile( &sel ) != SUCCESS ) || !sensorMgrTask_selectOpProfile( sel ) )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    }
     // Unsupported Command ID for this Command Group
     default:
       rspVal = MUJOE_RSP_INV_CMD_ID;
@@ -115,6 +139,17 @@ static uint16 cmdGroup_datGrp( uint8 cmd_id )
       osal_set_event( muJoeGenMgr.asyncBulkCb.tskId, muJoeGenMgr.asyncBulkCb.evtFlg );
       break;
     }
+    case MUJOE_GRP_DAT_ID_BBOXCLEAR:
+      if( !sensorMgrTask_clearBlackBox() )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    case MUJOE_GRP_DAT_ID_FUELCAPSTART:
+      if( !sensorMgrTask_startFuelCapture() )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    case MUJOE_GRP_DAT_ID_FUELCAPSTOP:
+      sensorMgrTask_stopFuelCapture();
+      break;
     // Unsupported Command ID for this Command Group
     default:
       rspVal = MUJOE_RSP_INV_CMD_ID;
@@ -124,6 +159,63 @@ static uint16 cmdGroup_datGrp( uint8 cmd_id )
   return rspVal;
 } // cmdGroup_datGrp
 
+static uint16 cmdGroup_calGrp( uint8 cmd_id )
+{
+  uint16 rspVal = MUJOE_RSP_SUCCESS;
+  
+  switch(cmd_id)
+  {
+    case MUJOE_GRP_CAL_ID_FUELTILTCOEFF:
+    {
+      mujoeFuelTiltCoeff_t coeff;
+      if( ( getFuelTiltCoeff( &coeff ) != SUCCESS ) || !sensorMgrTask_setFuelTiltCoeff( &coeff ) )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    }
+    case MUJOE_GRP_CAL_ID_FUELTILTLEVEL:
+      if( !sensorMgrTask_setFuelTiltLevelRef() )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    case MUJOE_GRP_CAL_ID_ACCELOFFSET:
+      sensorMgrTask_startAccelCal();
+      break;
+    case MUJOE_GRP_CAL_ID_FUELTTETHRESH:
+    {
+      uint16 thresh[FUELBURN_NUM_THRESH];
+      if( ( getFuelTteThresh( thresh ) != SUCCESS ) || !sensorMgrTask_setFuelTteThresholds( thresh ) )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    }
+    case MUJOE_GRP_CAL_ID_TANKCALSTART:
+      sensorMgrTask_startTankCal();
+      break;
+    case MUJOE_GRP_CAL_ID_TANKCALPOINT:
+    {
+      uint16 vol;
+      if( ( getTankCalVolume( &vol ) != SUCCESS ) || !sensorMgrTask_addTankCalPoint( vol ) )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    }
+    case MUJOE_GRP_CAL_ID_TANKCALSAVE:
+      if( !sensorMgrTask_finishTankCal() )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    case MUJOE_GRP_CAL_ID_FUELCRITTHRESH:
+    {
+      uint8 thresh;
+      if( ( getFuelCritThresh( &thresh ) != SUCCESS ) || !sensorMgrTask_setFuelCritThresh( thresh ) )
+        rspVal = MUJOE_RSP_FAILURE;
+      break;
+    }
+    // Unsupported Command ID for this Command Group
+    default:
+      rspVal = MUJOE_RSP_INV_CMD_ID;
+      break;
+  }
+  
+  return rspVal;
+} // cmdGroup_calGrp
+
 static bStatus_t getAsyncSamplePeriod( uint32 *pSampPeriod )
 {
   bStatus_t bStatus = SUCCESS;
@@ -142,3 +234,70 @@ static bStatus_t getAsyncSamplePeriod( uint32 *pSampPeriod )
   }
   return bStatus;
 } // getAsyncSamplePeriod
+
+// Mailbox holds refX, refY, kX, kY, kXX, kYY as int16, MSB first
+static bStatus_t getFuelTiltCoeff( mujoeFuelTiltCoeff_t *pCoeff )
+{
+  bStatus_t bStatus = SUCCESS;
+  uint8 mailBoxBuff[20];
+  bStatus =  muJoeGenProfile_readMailbox( mailBoxBuff, sizeof(mailBoxBuff) );
+  
+  if( bStatus == SUCCESS )
+  {
+     int16 *pVal = (int16 *)pCoeff;
+     for( uint8 i = 0; i < ( sizeof( mujoeFuelTiltCoeff_t ) / sizeof( int16 ) ); i++ )
+       pVal[i] = (int16)BUILD_UINT16( mailBoxBuff[2*i + 1], mailBoxBuff[2*i] );
+  }
+  return bStatus;
+} // getFuelTiltCoeff
+
+// Mailbox holds FUELBURN_NUM_THRESH thresholds (min) as uint16, MSB first
+static bStatus_t getFuelTteThresh( uint16 *pThresh )
+{
+  bStatus_t bStatus = SUCCESS;
+  uint8 mailBoxBuff[20];
+  bStatus =  muJoeGenProfile_readMailbox( mailBoxBuff, sizeof(mailBoxBuff) );
+  
+  if( bStatus == SUCCESS )
+  {
+     for( uint8 i = 0; i < FUELBURN_NUM_THRESH; i++ )
+       pThresh[i] = BUILD_UINT16( mailBoxBuff[2*i + 1], mailBoxBuff[2*i] );
+  }
+  return bStatus;
+} // getFuelTteThresh
+
+// Mailbox holds the fill volume (mL) as uint16, MSB first
+static bStatus_t getTankCalVolume( uint16 *pVol )
+{
+  bStatus_t bStatus = SUCCESS;
+  uint8 mailBoxBuff[20];
+  bStatus =  muJoeGenProfile_readMailbox( mailBoxBuff, sizeof(mailBoxBuff) );
+  
+  if( bStatus == SUCCESS )
+    *pVol = BUILD_UINT16( mailBoxBuff[1], mailBoxBuff[0] );
+  return bStatus;
+} // getTankCalVolume
+
+// Mailbox holds the threshold (%) as uint8
+static bStatus_t getFuelCritThresh( uint8 *pThresh )
+{
+  bStatus_t bStatus = SUCCESS;
+  uint8 mailBoxBuff[20];
+  bStatus =  muJoeGenProfile_readMailbox( mailBoxBuff, sizeof(mailBoxBuff) );
+  
+  if( bStatus == SUCCESS )
+    *pThresh = mailBoxBuff[0];
+  return bStatus;
+} // getFuelCritThresh
+
+// Mailbox holds the profile (mujoeOpProfileId_t) or OPPROFILE_AUTO as uint8
+static bStatus_t getOpProfile( uint8 *pSel )
+{
+  bStatus_t bStatus = SUCCESS;
+  uint8 mailBoxBuff[20];
+  bStatus =  muJoeGenProfile_readMailbox( mailBoxBuff, sizeof(mailBoxBuff) );
+  
+  if( bStatus == SUCCESS )
+    *pSel = mailBoxBuff[0];
+  return bStatus;
+} // getOpProfile
@@ -25,12 +25,27 @@
 // Command Groups
 #define MUJOE_CMD_GRP_SYS                   0x01
 #define MUJOE_CMD_GRP_DAT                   0x02
+#define MUJOE_CMD_GRP_CAL                   0x03
 
 // Command IDs for Command Group "System"
 #define MUJOE_GRP_SYS_ID_PWRDWN             0x01
+#define MUJOE_GRP_SYS_ID_OPPROFILE          0x02    // Select operating profile from Mailbox (uint8: 0 storage, 1 ground, 2 flight, 0xFF auto)
 
 // Command IDs for Command Group "Data"
 #define MUJOE_GRP_DAT_ID_STASYNCBULK        0x01    // Start data collection and post to Async Bulk
+#define MUJOE_GRP_DAT_ID_BBOXCLEAR          0x02    // Erase the stored black box events
+#define MUJOE_GRP_DAT_ID_FUELCAPSTART       0x03    // Stream fuel gauge capacitances to Async Bulk, ground profile only
+#define MUJOE_GRP_DAT_ID_FUELCAPSTOP        0x04    // Return Async Bulk to normal packets
+
+// Command IDs for Command Group "Calibration"
+#define MUJOE_GRP_CAL_ID_FUELTILTCOEFF      0x01    // Set fuel tilt coefficients from Mailbox (6 x int16, MSB first)
+#define MUJOE_GRP_CAL_ID_FUELTILTLEVEL      0x02    // Take current attitude as level for fuel tilt correction
+#define MUJOE_GRP_CAL_ID_ACCELOFFSET        0x03    // Start accelerometer offset calibration (unit at rest), outcome notified
+#define MUJOE_GRP_CAL_ID_FUELTTETHRESH      0x04    // Set time to empty alert thresholds from Mailbox (3 x uint16 min, descending, MSB first)
+#define MUJOE_GRP_CAL_ID_TANKCALSTART       0x05    // Start a tank capacitance to volume calibration
+#define MUJOE_GRP_CAL_ID_TANKCALPOINT       0x06    // Record capacitance at the fill volume in Mailbox (uint16 mL, MSB first)
+#define MUJOE_GRP_CAL_ID_TANKCALSAVE        0x07    // Activate and store the tank calibration
+#define MUJOE_GRP_CAL_ID_FUELCRITTHRESH     0x08    // Set critical fuel level threshold from Mailbox (uint8 %)
 
 // Solicited Response Codes
 #define MUJOE_RSP_SUCCESS                   0x0001      // Command successful
@@ -39,6 +54,13 @@
 #define MUJOE_RSP_INV_CMD_ID                0x0003      // Invalid Command ID
 #define MUJOE_RSP_CMD_TIMEOUT               0x0004      // Command timed out
 
+// Unsolicited Response Codes
+#define MUJOE_NOTI_FUEL_TTE                 0x8100      // Time to empty below threshold, LSByte = thresholds crossed
+#define MUJOE_NOTI_FUEL_CRIT                0x8200      // Fuel level at or below the critical threshold
+#define MUJOE_NOTI_FUEL_CRIT_CLR            0x8201      // Fuel level back above the critical threshold
+#define MUJOE_NOTI_ACCEL_CAL_DONE           0x8300      // Accelerometer offsets calibrated and stored
+#define MUJOE_NOTI_ACCEL_CAL_FAIL           0x8301      // Accelerometer calibration aborted (unit moved) or not stored
+
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
@@ -70,5 +92,6 @@ typedef struct muJoeGenMgr_def
 
 void muJoeGenMgr_initDriver( muJoeGenMgr_t s );
 bStatus_t muJoeGenMgr_cmdWriteHandler( void );
+void muJoeGenMgr_issueNotification( uint16 notiCode );
 
 #endif
\ No newline at end of file
@@ -193,6 +193,25 @@ bool mujoeI2C_i2cPingSlave( uint8 slaWriteAddr )
     
 } // mujoeI2C_i2cPingSlave
 
+// Sends a START condition followed by SLA + W and closes the transaction with
+// a STOP. Used to poll devices that NACK their address while busy (e.g. EEPROM
+// internal write cycle).
+// Returns TRUE if ACK was RX'd from slave, FALSE otherwise.
+bool mujoeI2C_ackPoll( uint8 slaWriteAddr )
+{
+  bool ack = ( masterStartI2C( slaWriteAddr, 0 ) == mstAddrAckW ) ? TRUE : FALSE;
+  
+  {
+                                                  // *NOTE: Must set STOP before clearing I2CC.SI bit
+    I2CCFG |= I2C_STO;                            // Set STOP flag                
+    I2CCFG &= ~I2C_SI;                            // Clear interrupt flag
+    while ((I2CCFG & I2C_STO) != 0);              // Wait until STOP flag is cleared by hardware after transmit has completed
+  }
+  
+  return ack;
+  
+} // mujoeI2C_ackPoll
+
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS                             
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeOpProfile.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeOpProfile.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeOpProfile_t         mujoeOpProfile;
+
+// Profile settings, indexed by mujoeOpProfileId_t
+static const mujoeOpProfileCfg_t mujoeOpProfile_cfgTbl[OPPROFILE_NUM_PROFILES] =
+{
+  // OPPROFILE_STORAGE: 1 - 2 s link, Async Bulk at 1/16 of the requested rate
+  {
+    .accelProfile = MMAMGR_PROFILE_MOTION_WAKE,
+    .sensors = 0,
+    .rpm = FALSE,
+    .baroMaxOsrLvl = 0,
+    .baroMinPeriod = 0,
+    .logShift = 4,
+    .connIntMin = 800,
+    .connIntMax = 1600,
+    .slaveLatency = 1,
+  },
+  // OPPROFILE_GROUND: baro at 1 Hz and OSR 1024 at most, 200 ms - 1 s link
+  {
+    .accelProfile = MMAMGR_PROFILE_IDLE,
+    .sensors = OPPROFILE_SENSORS_ALWAYS | OPPROFILE_SENSORS_MOTION,
+    .rpm = TRUE,
+    .baroMaxOsrLvl = 2,
+    .baroMinPeriod = 1000,
+    .logShift = 2,
+    .connIntMin = 160,
+    .connIntMax = 800,
+    .slaveLatency = 2,
+  },
+  // OPPROFILE_FLIGHT: 30 - 100 ms link
+  {
+    .accelProfile = MMAMGR_PROFILE_FLIGHT,
+    .sensors = OPPROFILE_SENSORS_ALWAYS | OPPROFILE_SENSORS_MOTION,
+    .rpm = TRUE,
+    .baroMaxOsrLvl = MS5MGR_NUM_OSR_LVLS - 1,
+    .baroMinPeriod = 0,
+    .logShift = 0,
+    .connIntMin = 24,
+    .connIntMax = 80,
+    .slaveLatency = 0,
+  },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Starts on the ground under automatic selection, nothing applied yet
+void mujoeOpProfile_init( void )
+{
+  VOID memset( &mujoeOpProfile, 0, sizeof( mujoeOpProfile_t ) );
+  mujoeOpProfile.active = OPPROFILE_NUM_PROFILES;
+  mujoeOpProfile.autoSel = TRUE;
+  mujoeOpProfile.manual = OPPROFILE_GROUND;
+  mujoeOpProfile.detected = OPPROFILE_GROUND;
+
+} // mujoeOpProfile_init
+
+// Selects a profile by id, or OPPROFILE_AUTO to follow the detector. The
+// caller applies the new target. Returns FALSE for an unknown selection.
+bool mujoeOpProfile_select( uint8 sel )
+{
+  if( sel == OPPROFILE_AUTO )
+  {
+    mujoeOpProfile.autoSel = TRUE;
+    return TRUE;
+  }
+  if( sel >= OPPROFILE_NUM_PROFILES )
+    return FALSE;
+
+  mujoeOpProfile.autoSel = FALSE;
+  mujoeOpProfile.manual = (mujoeOpProfileId_t)sel;
+  return TRUE;
+
+} // mujoeOpProfile_select
+
+// Returns the selection as set by mujoeOpProfile_select
+uint8 mujoeOpProfile_getSelection( void )
+{
+  return mujoeOpProfile.autoSel ? OPPROFILE_AUTO : (uint8)mujoeOpProfile.manual;
+
+} // mujoeOpProfile_getSelection
+
+// Returns the profile that should be applied
+mujoeOpProfileId_t mujoeOpProfile_getTarget( void )
+{
+  return mujoeOpProfile.autoSel ? mujoeOpProfile.detected : mujoeOpProfile.manual;
+
+} // mujoeOpProfile_getTarget
+
+mujoeOpProfileId_t mujoeOpProfile_getActive( void )
+{
+  return mujoeOpProfile.active;
+
+} // mujoeOpProfile_getActive
+
+// Records the profile once all of its settings are applied
+void mujoeOpProfile_setActive( mujoeOpProfileId_t id )
+{
+  mujoeOpProfile.active = id;
+
+} // mujoeOpProfile_setActive
+
+// Returns the settings of a profile, NULL for an unknown id
+const mujoeOpProfileCfg_t *mujoeOpProfile_getCfg( mujoeOpProfileId_t id )
+{
+  if( id >= OPPROFILE_NUM_PROFILES )
+    return NULL;
+
+  return &mujoeOpProfile_cfgTbl[id];
+
+} // mujoeOpProfile_getCfg
+
+// Flight state detector, call every "dtMs". "running" is TRUE while the engine
+// runs or the airframe climbs or sinks, "moving" while it is handled or carried.
+// Flight is entered at once and left after OPPROFILE_LAND_TIME quiet, storage
+// is entered after OPPROFILE_STORAGE_TIME still and left on the first motion.
+// Returns TRUE if the target changed under automatic selection.
+bool mujoeOpProfile_detect( bool running, bool moving, uint16 dtMs )
+{
+  mujoeOpProfileId_t detected = mujoeOpProfile.detected;
+
+  switch( detected )
+  {
+    case OPPROFILE_FLIGHT:
+      if( running )
+        mujoeOpProfile.quietTime = 0;
+      else if( ( mujoeOpProfile.quietTime += dtMs ) >= OPPROFILE_LAND_TIME )
+        detected = OPPROFILE_GROUND;
+      break;
+    case OPPROFILE_GROUND:
+      if( running )
+        detected = OPPROFILE_FLIGHT;
+      else if( moving )
+        mujoeOpProfile.quietTime = 0;
+      else if( ( mujoeOpProfile.quietTime += dtMs ) >= OPPROFILE_STORAGE_TIME )
+        detected = OPPROFILE_STORAGE;
+      break;
+    default:
+      if( running || moving )
+        detected = OPPROFILE_GROUND;
+      break;
+  }
+
+  if( detected == mujoeOpProfile.detected )
+    return FALSE;
+
+  mujoeOpProfile.detected = detected;
+  mujoeOpProfile.quietTime = 0;
+  return mujoeOpProfile.autoSel;
+
+} // mujoeOpProfile_detect
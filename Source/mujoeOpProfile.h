@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeOpProfile.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEOPPROFILE_H
+#define MUJOEOPPROFILE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "MMA8453QMgr.h"
+#include "MS560702Mgr.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Selection value handing the profile choice to the flight state detector
+#define OPPROFILE_AUTO                  0xFF
+
+// Sensor power classes scheduled by a profile, bit n = sensorPwrClass_t n
+#define OPPROFILE_SENSORS_ALWAYS        0x01
+#define OPPROFILE_SENSORS_MOTION        0x02
+
+// Quiet time (ms) before the detector drops from flight to ground, i.e. engine
+// stopped and no climb or sink
+#define OPPROFILE_LAND_TIME             60000
+
+// Still time (ms) before the detector drops from ground to storage
+#define OPPROFILE_STORAGE_TIME          900000
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+// Operating profiles, see mujoeOpProfile_cfgTbl
+typedef enum
+{
+  OPPROFILE_STORAGE = 0,        // Sensors parked, accel armed for motion wake only, slowest link
+  OPPROFILE_GROUND,             // Low rate sampling at reduced OSR, relaxed link
+  OPPROFILE_FLIGHT,             // Full rate sampling with adaptive OSR
+  OPPROFILE_NUM_PROFILES,
+
+}mujoeOpProfileId_t;
+
+// Everything a profile switches. Connection parameters are in units of 1.25 ms
+// and must stay within the supervision timeout of mainTask.
+typedef struct mujoeOpProfileCfg_def
+{
+  mma8453qMgr_profileId_t       accelProfile;
+  uint8                         sensors;        // OPPROFILE_SENSORS_* classes scheduled
+  bool                          rpm;            // Run the engine RPM estimator
+  uint8                         baroMaxOsrLvl;  // Highest barometer OSR level
+  uint16                        baroMinPeriod;  // Shortest barometer sample period (ms), 0 for none
+  uint8                         logShift;       // Async Bulk period = requested period << logShift
+  uint16                        connIntMin;
+  uint16                        connIntMax;
+  uint16                        slaveLatency;
+
+}mujoeOpProfileCfg_t;
+
+typedef struct mujoeOpProfile_def
+{
+  mujoeOpProfileId_t    active;         // Applied profile, OPPROFILE_NUM_PROFILES before the first
+  bool                  autoSel;        // TRUE while the detector picks the profile
+  mujoeOpProfileId_t    manual;         // Profile selected by command
+  mujoeOpProfileId_t    detected;       // Profile the detector asks for
+  uint32                quietTime;      // Time (ms) the detected state has been winding down
+
+}mujoeOpProfile_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeOpProfile_init( void );
+bool mujoeOpProfile_select( uint8 sel );
+uint8 mujoeOpProfile_getSelection( void );
+mujoeOpProfileId_t mujoeOpProfile_getTarget( void );
+mujoeOpProfileId_t mujoeOpProfile_getActive( void );
+void mujoeOpProfile_setActive( mujoeOpProfileId_t id );
+const mujoeOpProfileCfg_t *mujoeOpProfile_getCfg( mujoeOpProfileId_t id );
+bool mujoeOpProfile_detect( bool running, bool moving, uint16 dtMs );
+
+#endif // MUJOEOPPROFILE_H
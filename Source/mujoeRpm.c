@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeRpm.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeRpm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeRpm_t       mujoeRpm = 
+{
+  .pBlock = NULL,
+  .pPower = NULL,
+  .rpm = 0,
+};
+
+// Goertzel coefficients 2 * cos( 2 * pi * k / RPM_BLOCK_LEN ), Q14, k = RPM_BIN_MIN thru RPM_BIN_MAX
+static const int16 rpmCoeffTbl[RPM_NUM_BINS] = 
+{
+  28899, 28106, 27246, 26320, 25330, 24279, 23170, 22006,
+  20788, 19520, 18205, 16846, 15447, 14010, 12540, 11039,
+  9512, 7962, 6393, 4808, 3212, 1608, 0, -1608,
+  -3212, -4808, -6393, -7962, -9512, -11039, -12540, -14010,
+  -15447, -16846, -18205, -19520, -20788, -22006, -23170,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static int32 mujoeRpm_goertzel( int8 *pSamples, int16 coeff );
+static void mujoeRpm_findPeak( void );
+static void mujoeRpm_measureRate( uint32 span );
+static void mujoeRpm_freeBlock( void );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Allocates the capture block. Returns FALSE if out of heap or already capturing.
+bool mujoeRpm_startCapture( void )
+{
+  if( mujoeRpm.pBlock != NULL )
+    return FALSE;
+  
+  mujoeRpm.pBlock = (int8 *)osal_mem_alloc( RPM_BLOCK_LEN * RPM_NUM_AXES );
+  mujoeRpm.pPower = (int32 *)osal_mem_alloc( RPM_NUM_BINS * sizeof( int32 ) );
+  if( ( mujoeRpm.pBlock == NULL ) || ( mujoeRpm.pPower == NULL ) )
+  {
+    mujoeRpm_freeBlock();
+    return FALSE;
+  }
+  
+  mujoeRpm.sampleCnt = 0;
+  mujoeRpm.decCnt = 0;
+  VOID memset( mujoeRpm.decSum, 0, sizeof( mujoeRpm.decSum ) );
+  mujoeRpm.bin = 0;
+  mujoeRpm.rateQ4 = RPM_SAMPLE_RATE * 16;
+  return TRUE;
+  
+} // mujoeRpm_startCapture
+
+void mujoeRpm_abortCapture( void )
+{
+  mujoeRpm_freeBlock();
+  
+} // mujoeRpm_abortCapture
+
+// Returns TRUE while the capture block is still being filled
+bool mujoeRpm_isCapturing( void )
+{
+  return ( ( mujoeRpm.pBlock != NULL ) && ( mujoeRpm.sampleCnt < RPM_BLOCK_LEN ) ) ? TRUE : FALSE;
+  
+} // mujoeRpm_isCapturing
+
+// Returns TRUE while a full block is waiting to be processed
+bool mujoeRpm_isBlockReady( void )
+{
+  return ( ( mujoeRpm.pBlock != NULL ) && ( mujoeRpm.sampleCnt == RPM_BLOCK_LEN ) ) ? TRUE : FALSE;
+  
+} // mujoeRpm_isBlockReady
+
+// Adds an XYZ sample with gravity removed (10-bit counts), stamped at DRDY.
+// Every RPM_DECIMATION samples are averaged into one block sample, clipped to
+// 8 bits. Returns TRUE once the block is full.
+bool mujoeRpm_addSample( int16 *pAC, uint32 timestamp )
+{
+  if( !mujoeRpm_isCapturing() )
+    return FALSE;
+  
+  if( ( mujoeRpm.sampleCnt == 0 ) && ( mujoeRpm.decCnt == 0 ) )
+    mujoeRpm.firstTs = timestamp;
+  
+  for( uint8 i = 0; i < RPM_NUM_AXES; i++ )
+    mujoeRpm.decSum[i] += pAC[i];
+  if( ++mujoeRpm.decCnt < RPM_DECIMATION )
+    return FALSE;
+  mujoeRpm.decCnt = 0;
+  
+  for( uint8 i = 0; i < RPM_NUM_AXES; i++ )
+  {
+    int16 val = mujoeRpm.decSum[i] / RPM_DECIMATION;
+    mujoeRpm.decSum[i] = 0;
+    if( val > 127 ){ val = 127; }
+    if( val < -128 ){ val = -128; }
+    mujoeRpm.pBlock[i * RPM_BLOCK_LEN + mujoeRpm.sampleCnt] = (int8)val;
+  }
+  
+  if( ++mujoeRpm.sampleCnt < RPM_BLOCK_LEN )
+    return FALSE;
+  
+  mujoeRpm_measureRate( timestamp - mujoeRpm.firstTs );
+  return TRUE;
+  
+} // mujoeRpm_addSample
+
+// Runs one Goertzel bin over all axes per call so the block is processed in
+// short slices between other OSAL events. Returns TRUE once the estimate is
+// updated and the block released.
+bool mujoeRpm_process( void )
+{
+  if( !mujoeRpm_isBlockReady() )
+    return FALSE;
+  
+  int32 power = 0;
+  for( uint8 i = 0; i < RPM_NUM_AXES; i++ )
+    power += mujoeRpm_goertzel( mujoeRpm.pBlock + i * RPM_BLOCK_LEN, rpmCoeffTbl[mujoeRpm.bin] );
+  mujoeRpm.pPower[mujoeRpm.bin] = power;
+  
+  if( ++mujoeRpm.bin < RPM_NUM_BINS )
+    return FALSE;
+  
+  mujoeRpm_findPeak();
+  mujoeRpm_freeBlock();
+  return TRUE;
+  
+} // mujoeRpm_process
+
+// Returns the last engine speed estimate (RPM), 0 if no engine tone was found
+uint16 mujoeRpm_getRpm( void )
+{
+  return mujoeRpm.rpm;
+  
+} // mujoeRpm_getRpm
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Returns the power of one DFT bin (scaled by 1/16) over RPM_BLOCK_LEN samples.
+// 8-bit input keeps the states within +/-35k, so coeff * s1 fits in 32 bits.
+static int32 mujoeRpm_goertzel( int8 *pSamples, int16 coeff )
+{
+  int32 s1 = 0;
+  int32 s2 = 0;
+  
+  for( uint8 n = 0; n < RPM_BLOCK_LEN; n++ )
+  {
+    int32 s0 = pSamples[n] + ( ( (int32)coeff * s1 ) >> RPM_COEFF_Q ) - s2;
+    s2 = s1;
+    s1 = s0;
+  }
+  
+  // |X(k)|^2 = s1^2 + s2^2 - coeff * s1 * s2
+  s1 >>= 2;
+  s2 >>= 2;
+  return s1 * s1 + s2 * s2 - ( ( (int32)coeff * s1 ) >> RPM_COEFF_Q ) * s2;
+  
+} // mujoeRpm_goertzel
+
+// Picks the strongest bin and refines it by fitting a parabola through its neighbours
+static void mujoeRpm_findPeak( void )
+{
+  int32 *pP = mujoeRpm.pPower;
+  uint8 peak = 0;
+  int32 sum = 0;
+  
+  for( uint8 i = 0; i < RPM_NUM_BINS; i++ )
+  {
+    sum += pP[i] >> 6;
+    if( pP[i] > pP[peak] )
+      peak = i;
+  }
+  
+  int32 mean = sum / RPM_NUM_BINS;
+  if( ( pP[peak] < RPM_MIN_PEAK_POWER ) || ( ( pP[peak] >> 6 ) < mean * RPM_MIN_PEAK_RATIO ) )
+  {
+    mujoeRpm.rpm = 0;
+    return;
+  }
+  
+  // Bin offset of the vertex, Q8, within +/- 0.5 bin
+  int16 delta = 0;
+  if( ( peak > 0 ) && ( peak < RPM_NUM_BINS - 1 ) )
+  {
+    int32 l = pP[peak - 1] >> 8;
+    int32 c = pP[peak] >> 8;
+    int32 r = pP[peak + 1] >> 8;
+    int32 den = 2 * c - l - r;
+    if( den > 0 )
+      delta = (int16)( ( ( r - l ) << 7 ) / den );
+  }
+  
+  // RPM = k * rate * 60 / RPM_BLOCK_LEN = k * rate * 15 / 32, k in Q8, rate in Q4
+  int32 kQ8 = ( ( (int32)( peak + RPM_BIN_MIN ) ) << 8 ) + delta;
+  mujoeRpm.rpm = (uint16)( ( ( ( kQ8 * mujoeRpm.rateQ4 ) >> 4 ) * 15 ) >> 13 );
+  
+} // mujoeRpm_findPeak
+
+// Sets the block sample rate from the stamp span of a full block, which covers
+// RPM_BLOCK_LEN * RPM_DECIMATION - 1 input sample periods
+static void mujoeRpm_measureRate( uint32 span )
+{
+  const uint16 nominal = RPM_SAMPLE_RATE * 16;
+  uint32 rate = 0;
+  
+  if( span != 0 )
+    rate = ( ( RPM_BLOCK_LEN * RPM_DECIMATION - 1 ) * ( TS_TICKS_PER_SEC * 16 / RPM_DECIMATION ) ) / span;
+  
+  if( ( rate > nominal + nominal / RPM_RATE_TOL_DIV ) || ( rate < nominal - nominal / RPM_RATE_TOL_DIV ) )
+    rate = nominal;
+  mujoeRpm.rateQ4 = (uint16)rate;
+  
+} // mujoeRpm_measureRate
+
+static void mujoeRpm_freeBlock( void )
+{
+  if( mujoeRpm.pBlock != NULL )
+    osal_mem_free( mujoeRpm.pBlock );
+  if( mujoeRpm.pPower != NULL )
+    osal_mem_free( mujoeRpm.pPower );
+  mujoeRpm.pBlock = NULL;
+  mujoeRpm.pPower = NULL;
+  
+} // mujoeRpm_freeBlock
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeRpm.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOERPM_H
+#define MUJOERPM_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "mujoeTimestamp.h"
+#include "OSAL_Memory.h"        // for osal_mem_alloc
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Capture block length (samples per axis) and sample rate (Hz).
+// Bin spacing is RPM_SAMPLE_RATE / RPM_BLOCK_LEN = 3.125 Hz (187.5 RPM)
+#define RPM_BLOCK_LEN                   128
+#define RPM_SAMPLE_RATE                 400
+#define RPM_NUM_AXES                    3
+
+// Input samples averaged into each block sample, i.e. the 800 Hz vibration
+// profile is decimated to RPM_SAMPLE_RATE
+#define RPM_DECIMATION                  2
+
+// The block rate is measured from the first and last input sample stamps.
+// A measurement further than 1/RPM_RATE_TOL_DIV off RPM_SAMPLE_RATE means
+// samples were dropped, the nominal rate is used instead.
+#define RPM_RATE_TOL_DIV                8
+
+// Goertzel bank, bins k = RPM_BIN_MIN thru RPM_BIN_MAX of a RPM_BLOCK_LEN point DFT.
+// 31.25 Hz thru 150 Hz covers 1875 thru 9000 RPM
+#define RPM_BIN_MIN                     10
+#define RPM_BIN_MAX                     48
+#define RPM_NUM_BINS                    ( RPM_BIN_MAX - RPM_BIN_MIN + 1 )
+
+// Goertzel coefficient fractional bits
+#define RPM_COEFF_Q                     14
+
+// Peak bin power must exceed the bank's mean power by this factor to be reported
+#define RPM_MIN_PEAK_RATIO              6
+
+// Peak bin power below this is treated as engine off
+#define RPM_MIN_PEAK_POWER              20000L
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct mujoeRpm_def
+{
+  int8          *pBlock;        // Capture block, RPM_BLOCK_LEN samples per axis, allocated while capturing
+  int32         *pPower;        // Goertzel power per bin, allocated while capturing
+  uint8         sampleCnt;      // Samples captured into pBlock
+  int16         decSum[RPM_NUM_AXES];   // Decimation accumulator
+  uint8         decCnt;         // Input samples in decSum
+  uint8         bin;            // Next bin to process
+  uint32        firstTs;        // Stamp of the first input sample of the block
+  uint16        rateQ4;         // Measured block sample rate (Hz), Q4
+  uint16        rpm;            // Last estimate, 0 if no engine tone was found
+
+}mujoeRpm_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+bool mujoeRpm_startCapture( void );
+void mujoeRpm_abortCapture( void );
+bool mujoeRpm_isCapturing( void );
+bool mujoeRpm_isBlockReady( void );
+bool mujoeRpm_addSample( int16 *pAC, uint32 timestamp );
+bool mujoeRpm_process( void );
+uint16 mujoeRpm_getRpm( void );
+
+#endif // MUJOERPM_H
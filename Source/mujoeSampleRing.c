@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeSampleRing.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeSampleRing.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// GLOBAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+// Written only by the sensorMgrTask. OSAL tasks do not preempt each other, so a
+// reader never sees a half written sample.
+mujoeSampleRing_t               mujoeSampleRing;
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static uint8 mujoeSampleRing_claim( mujoeSampleRing_ch_t ch );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeSampleRing_init( void )
+{
+  VOID memset( &mujoeSampleRing, 0, sizeof( mujoeSampleRing_t ) );
+
+} // mujoeSampleRing_init
+
+void mujoeSampleRing_pushBaro( uint32 timestamp, int32 pres, int16 temp )
+{
+  uint8 idx = mujoeSampleRing_claim( SRING_CH_BARO );
+  mujoeSampleRing.baroTs[idx] = timestamp;
+  mujoeSampleRing.pres[idx] = pres;
+  mujoeSampleRing.temp[idx] = temp;
+
+} // mujoeSampleRing_pushBaro
+
+void mujoeSampleRing_pushAccel( uint32 timestamp, int16 *pXYZ )
+{
+  uint8 idx = mujoeSampleRing_claim( SRING_CH_ACCEL );
+  mujoeSampleRing.accTs[idx] = timestamp;
+  mujoeSampleRing.accX[idx] = pXYZ[0];
+  mujoeSampleRing.accY[idx] = pXYZ[1];
+  mujoeSampleRing.accZ[idx] = pXYZ[2];
+
+} // mujoeSampleRing_pushAccel
+
+void mujoeSampleRing_pushFuel( uint32 timestamp, int16 lvl, uint8 conf )
+{
+  uint8 idx = mujoeSampleRing_claim( SRING_CH_FUEL );
+  mujoeSampleRing.fuelTs[idx] = timestamp;
+  mujoeSampleRing.fuelLvl[idx] = lvl;
+  mujoeSampleRing.fuelConf[idx] = conf;
+
+} // mujoeSampleRing_pushFuel
+
+void mujoeSampleRing_pushAux( uint32 timestamp, uint8 slot, int32 val )
+{
+  uint8 idx = mujoeSampleRing_claim( SRING_CH_AUX );
+  mujoeSampleRing.auxTs[idx] = timestamp;
+  mujoeSampleRing.auxSlot[idx] = slot;
+  mujoeSampleRing.auxVal[idx] = val;
+
+} // mujoeSampleRing_pushAux
+
+// Starts a reader at the channel's next sample, earlier samples are skipped
+void mujoeSampleRing_initCursor( mujoeSampleRing_ch_t ch, mujoeSampleRingCursor_t *pCur )
+{
+  pCur->pos = mujoeSampleRing.count[ch];
+  pCur->lost = 0;
+
+} // mujoeSampleRing_initCursor
+
+// Returns the index of the reader's oldest unread sample and consumes it, or
+// SRING_NONE if there is none. A reader that fell more than SRING_DEPTH behind
+// resumes at the oldest sample still held and counts the rest as lost.
+uint8 mujoeSampleRing_next( mujoeSampleRing_ch_t ch, mujoeSampleRingCursor_t *pCur )
+{
+  uint16 avail = mujoeSampleRing.count[ch] - pCur->pos;
+
+  if( avail == 0 )
+    return SRING_NONE;
+
+  if( avail > SRING_DEPTH )
+  {
+    uint16 lost = avail - SRING_DEPTH;
+    pCur->lost = ( lost > 0xFF - pCur->lost ) ? 0xFF : (uint8)( pCur->lost + lost );
+    pCur->pos += lost;
+  }
+
+  return (uint8)( pCur->pos++ ) & ( SRING_DEPTH - 1 );
+
+} // mujoeSampleRing_next
+
+// Returns the index of the newest sample and consumes everything up to it, or
+// SRING_NONE if the reader has seen it already. Skipped samples are not lost.
+uint8 mujoeSampleRing_latest( mujoeSampleRing_ch_t ch, mujoeSampleRingCursor_t *pCur )
+{
+  uint16 count = mujoeSampleRing.count[ch];
+
+  if( count == pCur->pos )
+    return SRING_NONE;
+
+  pCur->pos = count;
+  return (uint8)( count - 1 ) & ( SRING_DEPTH - 1 );
+
+} // mujoeSampleRing_latest
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Returns the slot for the channel's next sample, overwriting the oldest
+static uint8 mujoeSampleRing_claim( mujoeSampleRing_ch_t ch )
+{
+  return (uint8)( mujoeSampleRing.count[ch]++ ) & ( SRING_DEPTH - 1 );
+
+} // mujoeSampleRing_claim
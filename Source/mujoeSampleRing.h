@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeSampleRing.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOESAMPLERING_H
+#define MUJOESAMPLERING_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Samples kept per channel, must be a power of 2. 80 ms of accel at 100 Hz.
+#define SRING_DEPTH                     8
+
+// Returned by mujoeSampleRing_next when the reader is up to date
+#define SRING_NONE                      0xFF
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef enum
+{
+  SRING_CH_BARO = 0,
+  SRING_CH_ACCEL,
+  SRING_CH_FUEL,
+  SRING_CH_AUX,                         // Registered sensors without a channel of their own, see sensorDesc_t
+  SRING_NUM_CH,
+
+}mujoeSampleRing_ch_t;
+
+// Owned by each reader, one per channel it consumes
+typedef struct mujoeSampleRingCursor_def
+{
+  uint16        pos;                    // Samples consumed, compared with the channel count
+  uint8         lost;                   // Samples overwritten before they were read (saturates)
+
+}mujoeSampleRingCursor_t;
+
+// One array per field so a reader touches only what it uses. Samples are read
+// in place at the index returned by mujoeSampleRing_next.
+typedef struct mujoeSampleRing_def
+{
+  uint16        count[SRING_NUM_CH];    // Samples pushed per channel (wraps, 65536 is 655 s of accel)
+
+  uint32        baroTs[SRING_DEPTH];    // Sleep timer timestamp at pressure conversion completion
+  int32         pres[SRING_DEPTH];      // Pressure (Pa)
+  int16         temp[SRING_DEPTH];      // Temperature (0.01 degC)
+
+  uint32        accTs[SRING_DEPTH];     // Sleep timer timestamp at the newest drained DRDY
+  int16         accX[SRING_DEPTH];      // 10-bit counts
+  int16         accY[SRING_DEPTH];
+  int16         accZ[SRING_DEPTH];
+
+  uint32        fuelTs[SRING_DEPTH];    // Sleep timer timestamp at fuel gauge measurement ready
+  int16         fuelLvl[SRING_DEPTH];   // Slosh filtered fuel level (0.01 %)
+  uint8         fuelConf[SRING_DEPTH];  // Confidence (%)
+
+  uint32        auxTs[SRING_DEPTH];     // Sleep timer timestamp at job completion
+  uint8         auxSlot[SRING_DEPTH];   // Sensor slot, see sensorMgrTask_registerSensor
+  int32         auxVal[SRING_DEPTH];    // Sensor specific units
+
+}mujoeSampleRing_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// EXTERN VARS
+////////////////////////////////////////////////////////////////////////////////
+
+extern mujoeSampleRing_t        mujoeSampleRing;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeSampleRing_init( void );
+void mujoeSampleRing_pushBaro( uint32 timestamp, int32 pres, int16 temp );
+void mujoeSampleRing_pushAccel( uint32 timestamp, int16 *pXYZ );
+void mujoeSampleRing_pushFuel( uint32 timestamp, int16 lvl, uint8 conf );
+void mujoeSampleRing_pushAux( uint32 timestamp, uint8 slot, int32 val );
+void mujoeSampleRing_initCursor( mujoeSampleRing_ch_t ch, mujoeSampleRingCursor_t *pCur );
+uint8 mujoeSampleRing_next( mujoeSampleRing_ch_t ch, mujoeSampleRingCursor_t *pCur );
+uint8 mujoeSampleRing_latest( mujoeSampleRing_ch_t ch, mujoeSampleRingCursor_t *pCur );
+
+#endif // MUJOESAMPLERING_H
@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeTankLut.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeTankLut.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeTankLut_t   mujoeTankLut =
+{
+  .valid = FALSE,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static bool mujoeTankLut_check( mujoeTankLutTbl_t *pTbl );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Makes "pTbl" the active table, e.g. as restored from EEPROM. Returns FALSE,
+// leaving the active table unchanged, if it is malformed.
+bool mujoeTankLut_load( mujoeTankLutTbl_t *pTbl )
+{
+  if( !mujoeTankLut_check( pTbl ) )
+    return FALSE;
+
+  VOID memcpy( &mujoeTankLut.tbl, pTbl, sizeof( mujoeTankLutTbl_t ) );
+  mujoeTankLut.valid = TRUE;
+  return TRUE;
+
+} // mujoeTankLut_load
+
+bool mujoeTankLut_isValid( void )
+{
+  return mujoeTankLut.valid;
+
+} // mujoeTankLut_isValid
+
+// Converts a capacitance to volume (mL) by binary search for the bracketing
+// points and linear interpolation between them. Clamped to the table ends.
+uint16 mujoeTankLut_capToVolume( uint16 cap )
+{
+  mujoeTankLutPoint_t *pPts = mujoeTankLut.tbl.pts;
+  uint8 last = mujoeTankLut.tbl.numPoints - 1;
+
+  if( !mujoeTankLut.valid )
+    return 0;
+  if( cap <= pPts[0].cap )
+    return pPts[0].vol;
+  if( cap >= pPts[last].cap )
+    return pPts[last].vol;
+
+  // Find lo such that pts[lo].cap <= cap < pts[lo + 1].cap
+  uint8 lo = 0;
+  uint8 hi = last;
+  while( ( hi - lo ) > 1 )
+  {
+    uint8 mid = ( lo + hi ) >> 1;
+    if( pPts[mid].cap <= cap )
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  return pPts[lo].vol + (uint16)( ( (uint32)( pPts[hi].vol - pPts[lo].vol ) * ( cap - pPts[lo].cap ) ) /
+                                  ( pPts[hi].cap - pPts[lo].cap ) );
+
+} // mujoeTankLut_capToVolume
+
+// Converts a volume (mL) back to capacitance, the inverse of capToVolume. Where
+// the volume is flat across points the lowest capacitance is returned. Clamped
+// to the table ends.
+uint16 mujoeTankLut_volumeToCap( uint16 vol )
+{
+  mujoeTankLutPoint_t *pPts = mujoeTankLut.tbl.pts;
+  uint8 last = mujoeTankLut.tbl.numPoints - 1;
+
+  if( !mujoeTankLut.valid )
+    return 0;
+  if( vol <= pPts[0].vol )
+    return pPts[0].cap;
+  if( vol >= pPts[last].vol )
+    return pPts[last].cap;
+
+  // Find hi such that pts[hi - 1].vol < vol <= pts[hi].vol
+  uint8 lo = 0;
+  uint8 hi = last;
+  while( ( hi - lo ) > 1 )
+  {
+    uint8 mid = ( lo + hi ) >> 1;
+    if( pPts[mid].vol < vol )
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  return pPts[lo].cap + (uint16)( ( (uint32)( pPts[hi].cap - pPts[lo].cap ) * ( vol - pPts[lo].vol ) ) /
+                                  ( pPts[hi].vol - pPts[lo].vol ) );
+
+} // mujoeTankLut_volumeToCap
+
+// Returns the volume (mL) of the fullest calibration point
+uint16 mujoeTankLut_getFullVolume( void )
+{
+  return mujoeTankLut.valid ? mujoeTankLut.tbl.pts[mujoeTankLut.tbl.numPoints - 1].vol : 0;
+
+} // mujoeTankLut_getFullVolume
+
+// Starts a new calibration table, the active table stays in use meanwhile
+void mujoeTankLut_startCal( void )
+{
+  VOID memset( &mujoeTankLut.cal, 0, sizeof( mujoeTankLutTbl_t ) );
+
+} // mujoeTankLut_startCal
+
+// Records "cap" measured at a known fill "vol" (mL), kept in capacitance order.
+// A point at an already recorded volume replaces it.
+bool mujoeTankLut_addCalPoint( uint16 cap, uint16 vol )
+{
+  mujoeTankLutTbl_t *pCal = &mujoeTankLut.cal;
+  uint8 i;
+
+  // Drop any earlier reading at this volume
+  for( i = 0; i < pCal->numPoints; i++ )
+  {
+    if( pCal->pts[i].vol == vol )
+    {
+      VOID memmove( &pCal->pts[i], &pCal->pts[i + 1], ( pCal->numPoints - i - 1 ) * sizeof( mujoeTankLutPoint_t ) );
+      pCal->numPoints--;
+      break;
+    }
+  }
+
+  if( pCal->numPoints >= TANKLUT_MAX_POINTS )
+    return FALSE;
+
+  // Insertion keeps the table sorted by capacitance
+  i = pCal->numPoints;
+  while( ( i > 0 ) && ( pCal->pts[i - 1].cap > cap ) )
+  {
+    pCal->pts[i] = pCal->pts[i - 1];
+    i--;
+  }
+  pCal->pts[i].cap = cap;
+  pCal->pts[i].vol = vol;
+  pCal->numPoints++;
+
+  return TRUE;
+
+} // mujoeTankLut_addCalPoint
+
+// Activates the calibration table. Returns it for persisting, or NULL if it has
+// too few points or the volume does not rise with capacitance.
+mujoeTankLutTbl_t *mujoeTankLut_finishCal( void )
+{
+  if( !mujoeTankLut_load( &mujoeTankLut.cal ) )
+    return NULL;
+
+  return &mujoeTankLut.tbl;
+
+} // mujoeTankLut_finishCal
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// A table needs TANKLUT_MIN_POINTS, strictly ascending capacitance and
+// non-decreasing volume that does rise overall
+static bool mujoeTankLut_check( mujoeTankLutTbl_t *pTbl )
+{
+  if( ( pTbl->numPoints < TANKLUT_MIN_POINTS ) || ( pTbl->numPoints > TANKLUT_MAX_POINTS ) )
+    return FALSE;
+  if( pTbl->pts[pTbl->numPoints - 1].vol <= pTbl->pts[0].vol )
+    return FALSE;
+
+  for( uint8 i = 1; i < pTbl->numPoints; i++ )
+  {
+    if( ( pTbl->pts[i].cap <= pTbl->pts[i - 1].cap ) || ( pTbl->pts[i].vol < pTbl->pts[i - 1].vol ) )
+      return FALSE;
+  }
+
+  return TRUE;
+
+} // mujoeTankLut_check
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeTankLut.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOETANKLUT_H
+#define MUJOETANKLUT_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "string.h"             // for memset, memcpy, memmove
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Max calibration points. The table is stored as one EEPROM record of at most
+// CAT24C512_RECORD_MAX_DATA_LEN (61) data bytes.
+#define TANKLUT_MAX_POINTS              14
+
+// Points needed for a usable table
+#define TANKLUT_MIN_POINTS              2
+
+// EEPROM record key of the table
+#define TANKLUT_RECORD_KEY              0x4C
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct mujoeTankLutPoint_def
+{
+  uint16        cap;            // Fuel gauge capacitance (MSPFG_CAP_ALGO counts)
+  uint16        vol;            // Fuel volume (mL)
+
+}mujoeTankLutPoint_t;
+
+// Points sorted by ascending capacitance, volume non-decreasing
+typedef struct mujoeTankLutTbl_def
+{
+  uint8                 numPoints;
+  mujoeTankLutPoint_t   pts[TANKLUT_MAX_POINTS];
+
+}mujoeTankLutTbl_t;
+
+typedef struct mujoeTankLut_def
+{
+  mujoeTankLutTbl_t     tbl;            // Active table
+  bool                  valid;          // TRUE once a table is loaded
+  mujoeTankLutTbl_t     cal;            // Table being calibrated
+
+}mujoeTankLut_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+bool mujoeTankLut_load( mujoeTankLutTbl_t *pTbl );
+bool mujoeTankLut_isValid( void );
+uint16 mujoeTankLut_capToVolume( uint16 cap );
+uint16 mujoeTankLut_volumeToCap( uint16 vol );
+uint16 mujoeTankLut_getFullVolume( void );
+void mujoeTankLut_startCal( void );
+bool mujoeTankLut_addCalPoint( uint16 cap, uint16 vol );
+mujoeTankLutTbl_t *mujoeTankLut_finishCal( void );
+
+#endif // MUJOETANKLUT_H
@@ -35,6 +35,10 @@ typedef enum
 {
   SENSORMGR_GENERIC = 0,
   SENSORMGR_HWINIT_DONE,     // Hardware init complete
+  SENSORMGR_FUEL_TTE_ALERT,  // Predicted time to empty fell below an alert threshold
+  SENSORMGR_OPPROFILE_CHANGE,// Operating profile target changed, see mujoeOpProfile_getTarget
+  SENSORMGR_ACCEL_CAL_DONE,  // Accelerometer offsets calibrated and persisted
+  SENSORMGR_ACCEL_CAL_FAIL,  // Accelerometer calibration aborted or not persisted
   
 }sensorMgrTask_msg_t;
 
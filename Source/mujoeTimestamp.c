@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeTimestamp.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeTimestamp.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeTimestamp_t mujoeTimestamp =
+{
+  .lastSt = 0,
+  .wraps = 0,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Seeds the rollover tracking, stamps then count from the current timer value
+void mujoeTimestamp_init( void )
+{
+  mujoeTimestamp.wraps = 0;
+  mujoeTimestamp.lastSt = 0;
+  VOID mujoeTimestamp_now();
+
+} // mujoeTimestamp_init
+
+// Returns the sleep timer extended to 32 bits. Safe to call from an ISR.
+// The timer keeps running in PM2, so stamps stay valid across sleep.
+uint32 mujoeTimestamp_now( void )
+{
+  halIntState_t intState;
+  uint32 st;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );
+
+  // ST0 must be read first, it latches ST1 and ST2
+  st = ST0;
+  st |= (uint32)ST1 << 8;
+  st |= (uint32)ST2 << 16;
+
+  if( st < mujoeTimestamp.lastSt )
+    mujoeTimestamp.wraps++;
+  mujoeTimestamp.lastSt = st;
+  st |= (uint32)mujoeTimestamp.wraps << 24;
+
+  HAL_EXIT_CRITICAL_SECTION( intState );
+
+  return st;
+
+} // mujoeTimestamp_now
+
+// Converts a stamp difference to ms, rounded down
+uint32 mujoeTimestamp_toMs( uint32 ticks )
+{
+  // Split so ticks * 1000 cannot overflow
+  return ( ticks >> 15 ) * 1000 + ( ( ( ticks & 0x7FFF ) * 1000 ) >> 15 );
+
+} // mujoeTimestamp_toMs
+
+// Converts ms to ticks, rounded down
+uint32 mujoeTimestamp_msToTicks( uint16 ms )
+{
+  return ( (uint32)ms << 15 ) / 1000;
+
+} // mujoeTimestamp_msToTicks
+
+// Returns the whole ms since the previous interval ended and starts the next one
+// at "now". The sub-ms remainder is carried into the next interval, so a run of
+// intervals adds up to the elapsed time without drift (125 ms = 4096 ticks
+// exactly). Intervals of 0xFFFF ms or more saturate and drop the remainder.
+uint16 mujoeTimestamp_takeDtMs( mujoeTimestampDt_t *pDt, uint32 now )
+{
+  uint32 ticks = now - pDt->last;
+  pDt->last = now;
+
+  if( ticks >= mujoeTimestamp_msToTicks( 0xFFFF ) )
+  {
+    pDt->rem = 0;
+    return 0xFFFF;
+  }
+
+  // ms = ticks * 125 / 4096
+  uint32 acc = ticks * 125 + pDt->rem;
+  pDt->rem = (uint16)( acc & 0x0FFF );
+  return (uint16)( acc >> 12 );
+
+} // mujoeTimestamp_takeDtMs
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeTimestamp.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOETIMESTAMP_H
+#define MUJOETIMESTAMP_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "hal_mcu.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Timestamps count the 32.768 kHz sleep timer (30.5 us ticks). The 32-bit
+// stamp wraps every 36.4 h, compare stamps by their difference only.
+#define TS_TICKS_PER_SEC                32768UL
+
+// The 24-bit sleep timer wraps every 512 s. A rollover is only caught if the
+// timer is read at least this often (ms).
+#define TS_ST_WRAP_PERIOD               512000UL
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct mujoeTimestamp_def
+{
+  uint32        lastSt;         // Last 24-bit sleep timer reading
+  uint8         wraps;          // Sleep timer rollovers, bits 24-31 of the stamp
+
+}mujoeTimestamp_t;
+
+// Interval tracker for mujoeTimestamp_takeDtMs
+typedef struct mujoeTimestampDt_def
+{
+  uint32        last;           // Stamp the previous interval ended at
+  uint16        rem;            // Sub-ms remainder carried over (ms / 4096)
+
+}mujoeTimestampDt_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeTimestamp_init( void );
+uint32 mujoeTimestamp_now( void );
+uint32 mujoeTimestamp_toMs( uint32 ticks );
+uint32 mujoeTimestamp_msToTicks( uint16 ms );
+uint16 mujoeTimestamp_takeDtMs( mujoeTimestampDt_t *pDt, uint32 now );
+
+#endif // MUJOETIMESTAMP_H
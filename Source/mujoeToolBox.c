@@ -28,3 +28,77 @@ bool mujoeToolBox_oneBitSet_uint8( uint8 byte )
   }
   
 } // mujoeToolBox_oneBitSet_uint8
+
+// Returns ( a * b ) >> shift without a 64-bit intermediate (the 8051 compiler
+// has no 64-bit integer type). The product is built from four 16x16 partial
+// products so it is only valid when the final result fits in an int32.
+// shift must be within 0 to 32. Each partial product is truncated on its own
+// so the result can be low by up to 3 LSBs.
+int32 mujoeToolBox_mulShr32( int32 a, int32 b, uint8 shift )
+{
+  bool neg = FALSE;
+  uint32 ua, ub, result;
+  
+  // Work on magnitudes, restore the sign at the end
+  if( a < 0 ){ ua = (uint32)(-a); neg = !neg; } else { ua = (uint32)a; }
+  if( b < 0 ){ ub = (uint32)(-b); neg = !neg; } else { ub = (uint32)b; }
+  
+  uint32 ah = ua >> 16, al = ua & 0xFFFF;
+  uint32 bh = ub >> 16, bl = ub & 0xFFFF;
+  
+  // High partial product carries a weight of 2^32
+  result = ( shift < 32 ) ? ( ( ah * bh ) << ( 32 - shift ) ) : ( ah * bh );
+  
+  // Middle partial products carry a weight of 2^16
+  if( shift >= 16 )
+    result += ( ( ah * bl ) >> ( shift - 16 ) ) + ( ( al * bh ) >> ( shift - 16 ) );
+  else
+    result += ( ( ah * bl ) << ( 16 - shift ) ) + ( ( al * bh ) << ( 16 - shift ) );
+  
+  // Low partial product
+  if( shift < 32 )
+    result += ( al * bl ) >> shift;
+  
+  return neg ? -(int32)result : (int32)result;
+  
+} // mujoeToolBox_mulShr32
+
+// Computes the CRC-8 (poly 0x07) of "len" bytes starting from seed "crc".
+// Seeding allows a CRC to be computed over non-contiguous fields.
+uint8 mujoeToolBox_crc8( uint8 crc, uint8 *pData, uint8 len )
+{
+  while( len-- )
+  {
+    crc ^= *pData++;
+    for( uint8 i = 0; i < 8; i++ )
+      crc = ( crc & 0x80 ) ? ( ( crc << 1 ) ^ 0x07 ) : ( crc << 1 );
+  }
+  
+  return crc;
+  
+} // mujoeToolBox_crc8
+
+// Returns floor( sqrt( val ) ) using the bit-by-bit method, no multiplies or divides
+uint16 mujoeToolBox_isqrt32( uint32 val )
+{
+  uint32 root = 0;
+  uint32 bit = 1UL << 30;
+  
+  while( bit > val )
+    bit >>= 2;
+  
+  while( bit )
+  {
+    if( val >= root + bit )
+    {
+      val -= root + bit;
+      root = ( root >> 1 ) + bit;
+    }
+    else
+      root >>= 1;
+    bit >>= 2;
+  }
+  
+  return (uint16)root;
+  
+} // mujoeToolBox_isqrt32
@@ -42,12 +42,17 @@ typedef struct osalEvt_def
 // MACROS 
 ////////////////////////////////////////////////////////////////////////////////
 
+#ifndef SFRIO
 #define SFRIO(x)   (*(volatile unsigned char *)(x))
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // FUNCTION PROTOS
 ////////////////////////////////////////////////////////////////////////////////
 
 bool mujoeToolBox_oneBitSet_uint8( uint8 byte );
+int32 mujoeToolBox_mulShr32( int32 a, int32 b, uint8 shift );
+uint8 mujoeToolBox_crc8( uint8 crc, uint8 *pData, uint8 len );
+uint16 mujoeToolBox_isqrt32( uint32 val );
 
 #endif // MUJOETOOLBOX_H
\ No newline at end of file
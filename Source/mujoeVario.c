@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeVario.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mujoeVario.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static mujoeVario_t     mujoeVario =
+{
+  .init = FALSE,
+};
+
+// ISA altitude (mm) from VARIO_ALT_TBL_MIN_PRES to VARIO_ALT_TBL_MAX_PRES in
+// VARIO_ALT_TBL_STEP_PRES increments: h = 44330.77 * ( 1 - ( p / 101325 )^0.190263 )
+// Linear interpolation between entries is within 0.7 m of the exact curve below
+// 3000 m, and within 2.9 m at the top of the table.
+static const int32 varioAltTbl[] =
+{
+  9163947, 8729461, 8316436, 7922638, 7546175, 7185429,
+  6839004, 6505690, 6184427, 5874282, 5574431, 5284140,
+  5002753, 4729682, 4464398, 4206420, 3955314, 3710684,
+  3472168, 3239434, 3012179, 2790122, 2573005, 2360588,
+  2152651, 1948987, 1749405, 1553727, 1361785, 1173425,
+  988500, 806873, 628415, 453006, 280532, 110884,
+  -56037, -220330, -382083, -541384, -698314,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+static void mujoeVario_propagate( int32 acc, uint16 dtMs );
+static int32 mujoeVario_clamp( int32 val, int32 limit );
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeVario_init( void )
+{
+  VOID memset( &mujoeVario, 0, sizeof( mujoeVario_t ) );
+  mujoeVario.accelAge = VARIO_ACCEL_TIMEOUT_MS;
+
+} // mujoeVario_init
+
+// Converts pressure (Pa) to ISA altitude (mm). Pressures outside the table are clamped.
+int32 mujoeVario_pressureToAltitude( int32 pressure )
+{
+  if( pressure <= VARIO_ALT_TBL_MIN_PRES )
+    return varioAltTbl[0];
+  if( pressure >= VARIO_ALT_TBL_MAX_PRES )
+    return varioAltTbl[( sizeof( varioAltTbl ) / sizeof( int32 ) ) - 1];
+
+  uint32 offset = (uint32)( pressure - VARIO_ALT_TBL_MIN_PRES );
+  uint8 idx = offset / VARIO_ALT_TBL_STEP_PRES;
+  int32 frac = offset % VARIO_ALT_TBL_STEP_PRES;
+
+  return varioAltTbl[idx] + ( ( varioAltTbl[idx + 1] - varioAltTbl[idx] ) * frac ) / VARIO_ALT_TBL_STEP_PRES;
+
+} // mujoeVario_pressureToAltitude
+
+// Corrects the fused state with a barometric altitude (mm) sampled "dtMs" after
+// the previous one. Without recent accel samples the filter predicts with constant
+// velocity and falls back to the baro only gains.
+void mujoeVario_baroUpdate( int32 baroAlt, uint16 dtMs )
+{
+  // Seed the filter with the first sample
+  if( !mujoeVario.init )
+  {
+    mujoeVario.alt = baroAlt;
+    mujoeVario.init = TRUE;
+    return;
+  }
+
+  if( dtMs > VARIO_MAX_DT_MS ){ dtMs = VARIO_MAX_DT_MS; }
+
+  bool accelAided = ( mujoeVario.accelAge < VARIO_ACCEL_TIMEOUT_MS ) ? TRUE : FALSE;
+  if( !accelAided )
+    mujoeVario_propagate( 0, dtMs );
+  else
+    mujoeVario.accelAge += dtMs;
+
+  int32 err = mujoeVario_clamp( baroAlt - mujoeVario.alt, VARIO_MAX_INNOV_MM );
+
+  if( accelAided )
+  {
+    mujoeVario.alt += ( err * VARIO_K1_ACCEL * dtMs ) / ( 1000L << VARIO_Q );
+    mujoeVario.vel += ( err * VARIO_K2_ACCEL * dtMs ) / 1000;
+    mujoeVario.accBias -= ( err * VARIO_K3_ACCEL * dtMs ) / 1000;
+  }
+  else
+  {
+    mujoeVario.alt += ( err * VARIO_K1_BARO * dtMs ) / ( 1000L << VARIO_Q );
+    mujoeVario.vel += ( err * VARIO_K2_BARO * dtMs ) / 1000;
+  }
+
+} // mujoeVario_baroUpdate
+
+// Integrates a vertical acceleration sample (mm/s^2, gravity removed, positive up)
+// taken "dtMs" after the previous one.
+void mujoeVario_accelUpdate( int32 accVert, uint16 dtMs )
+{
+  // Wait until baro has seeded the altitude
+  if( !mujoeVario.init )
+    return;
+
+  if( dtMs > VARIO_MAX_DT_MS ){ dtMs = VARIO_MAX_DT_MS; }
+
+  mujoeVario_propagate( accVert - ( mujoeVario.accBias >> VARIO_Q ), dtMs );
+  mujoeVario.accelAge = 0;
+
+} // mujoeVario_accelUpdate
+
+// Returns the fused vertical speed (cm/s, positive up)
+int16 mujoeVario_getVerticalSpeed( void )
+{
+  return (int16)( ( mujoeVario.vel >> VARIO_Q ) / 10 );
+
+} // mujoeVario_getVerticalSpeed
+
+// Returns the fused altitude (mm)
+int32 mujoeVario_getAltitude( void )
+{
+  return mujoeVario.alt;
+
+} // mujoeVario_getAltitude
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+// Advances velocity and altitude by "dtMs" under acceleration "acc" (mm/s^2)
+static void mujoeVario_propagate( int32 acc, uint16 dtMs )
+{
+  // Bound acc to +/- 16g so acc * dt * 32 cannot overflow
+  acc = mujoeVario_clamp( acc, 160000 );
+
+  // vel[Q8] += acc * dt * 256 / 1000
+  mujoeVario.vel += ( acc * dtMs * 32 ) / 125;
+  mujoeVario.vel = mujoeVario_clamp( mujoeVario.vel, ( (int32)VARIO_MAX_VEL_MMPS ) << VARIO_Q );
+
+  // alt += vel[Q8] * dt / ( 256 * 1000 ), keeping the remainder so slow climbs are not truncated away
+  int32 altAcc = mujoeVario.vel * dtMs + mujoeVario.altRem;
+  mujoeVario.alt += altAcc / ( 1000L << VARIO_Q );
+  mujoeVario.altRem = altAcc % ( 1000L << VARIO_Q );
+
+} // mujoeVario_propagate
+
+static int32 mujoeVario_clamp( int32 val, int32 limit )
+{
+  if( val > limit )
+    return limit;
+  else if( val < -limit )
+    return -limit;
+  else
+    return val;
+
+} // mujoeVario_clamp
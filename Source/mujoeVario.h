@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: mujoeVario.h
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEVARIO_H
+#define MUJOEVARIO_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "string.h"             // for memset
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Pressure to altitude lookup table bounds (Pa)
+#define VARIO_ALT_TBL_MIN_PRES          30000
+#define VARIO_ALT_TBL_MAX_PRES          110000
+#define VARIO_ALT_TBL_STEP_PRES         2000
+
+// Fractional bits carried by the velocity and accel bias states
+#define VARIO_Q                         8
+
+// Filter steps longer than this (ms) are clamped, i.e. after a sensor dropout
+#define VARIO_MAX_DT_MS                 100
+
+// Velocity state is clamped to +/- this value (mm/s) to bound the fixed point math
+#define VARIO_MAX_VEL_MMPS              50000
+
+// Baro innovation is clamped to +/- this value (mm) to reject pressure spikes
+#define VARIO_MAX_INNOV_MM              10000
+
+// Accel samples older than this (ms) drop the filter back to baro only gains
+#define VARIO_ACCEL_TIMEOUT_MS          250
+
+// Complementary filter gains (Q8, units of 1/s, 1/s^2 and 1/s^3).
+// Accel aided: 3rd order with w = 1 rad/s -> k1 = 3w, k2 = 3w^2, k3 = w^3
+#define VARIO_K1_ACCEL                  ( 3 << VARIO_Q )
+#define VARIO_K2_ACCEL                  ( 3 << VARIO_Q )
+#define VARIO_K3_ACCEL                  ( 1 << VARIO_Q )
+// Baro only: 2nd order alpha-beta tracker with w = 2 rad/s -> k1 = 2w, k2 = w^2
+#define VARIO_K1_BARO                   ( 4 << VARIO_Q )
+#define VARIO_K2_BARO                   ( 4 << VARIO_Q )
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct mujoeVario_def
+{
+  bool          init;           // TRUE once seeded by the first baro sample
+  int32         alt;            // Fused altitude (mm)
+  int32         altRem;         // Sub-mm remainder of the altitude integration
+  int32         vel;            // Fused vertical speed (mm/s, Q8)
+  int32         accBias;        // Vertical accel bias estimate (mm/s^2, Q8)
+  uint16        accelAge;       // Time since the last accel sample (ms)
+
+}mujoeVario_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// API FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeVario_init( void );
+int32 mujoeVario_pressureToAltitude( int32 pressure );
+void mujoeVario_baroUpdate( int32 baroAlt, uint16 dtMs );
+void mujoeVario_accelUpdate( int32 accVert, uint16 dtMs );
+int16 mujoeVario_getVerticalSpeed( void );
+int32 mujoeVario_getAltitude( void );
+
+#endif // MUJOEVARIO_H
@@ -19,24 +19,23 @@ boardSensorData_t               brdSensorDat;
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
 
-typedef struct evtCallback_def
-{    
-    uint32         delay;
-    
-}evtCallback_t;
-
-typedef struct sensorDatColl_def
+typedef struct sensorSched_def
 {
-  bool                  nextSensor;
-  uint8                 currSensor;
-  uint8                 numSensors;
-  uint8                 sensorState;
-  uint8                 sensorFlags;
-  evtCallback_t         evtCb;
-
-}sensorDatColl_t, *p_sensorDatColl_t;
+  const sensorDesc_t    *pDesc;
+  uint16                period;         // ms
+  uint32                deadline;       // System clock (ms) the current or next job is due
+  uint32                due;            // deadline, or when a waiting job resumes
+  bool                  busy;           // Job started and not yet done
+  bool                  converting;     // Conversion started, fetch when due
+  uint8                 step;           // Conversion within the job
+  uint8                 retryCnt;       // Conversion retries within the job
+  uint8                 failCnt;        // Failed jobs in a row
+  uint8                 reinitCnt;      // Re-inits since the last good sample
+  bool                  offline;
+  uint32                lastSig;        // getSig of the last good sample
+  uint8                 stuckCnt;       // Repeats of lastSig
 
-typedef void (*sensorDatCollFncTbl_t)( p_sensorDatColl_t );
+}sensorSched_t;
 
 ////////////////////////////////////////////////////////////////////////////////
 // LOCAL FUNCTIONS
@@ -45,10 +44,42 @@ typedef void (*sensorDatCollFncTbl_t)( p_sensorDatColl_t );
 static void sensorMgrTask_ProcessOSALMsg( osal_event_hdr_t *pMsg );
 static void sensorMgrTask_ProcessGATTMsg( gattMsgEvent_t *pMsg );
 static bool sensorMgrTask_initSensors( void );
+static bool sensorMgrTask_initBarometer( void );
 
-static void MS560702_dataCollector( p_sensorDatColl_t sdc );
-static void MMA8453_dataCollector( p_sensorDatColl_t sdc );
+static bool MS560702_startConv( uint8 step );
+static sensorFetch_t MS560702_fetch( uint8 step );
+static uint8 MS560702_convTime( void );
+static bool MS560702_processSample( void );
+static uint32 MS560702_getSig( void );
+static bool MMA8453_init( void );
+static sensorFetch_t MMA8453_fetch( uint8 step );
+static uint16 MMA8453_getPeriod( void );
+static void MMA8453_processSample( uint16 dtMs );
+static void MMA8453_drdyIntHdlr( void );
+static void MMA8453_motionIntHdlr( void );
+static void sensorMgrTask_rpmEstimator( void );
+static bool MSPFG_init( void );
+static sensorFetch_t MSPFG_fetch( uint8 step );
+static void MSPFG_suspend( void );
+static void MSPFG_dataRdyIntHdlr( void );
+static void MSPFG_checkCritLevel( int16 lvl );
+static bool MSPFG_programCritThresh( void );
+static void sensorMgrTask_initFuelTilt( void );
+static void sensorMgrTask_initTankLut( void );
+static bool sensorMgrTask_initAccelerometer( void );
+static void sensorMgrTask_finishAccelCal( void );
+static void sensorMgrTask_blackBoxSample( void );
 static void sensorMgrTask_dataCollector( void );
+static void sensorMgrTask_opProfileDetect( void );
+static void sensorMgrTask_schedRun( sensorSched_t *pSched );
+static void sensorMgrTask_schedFinish( sensorSched_t *pSched, uint32 now );
+static void sensorMgrTask_healthPass( sensorSched_t *pSched );
+static void sensorMgrTask_healthFail( sensorSched_t *pSched );
+static uint8 sensorMgrTask_schedEarliest( void );
+static bool sensorMgrTask_schedBusy( void );
+static bool sensorMgrTask_schedEnabled( sensorSched_t *pSched );
+static uint8 sensorMgrTask_schedEnabledMask( void );
+static void sensorMgrTask_schedPower( uint8 wasEnabled );
 static bool sensorMgrTask_SendOSALMsg( uint8 destTaskID, sensorMgrTask_msg_t msg );
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -57,20 +88,52 @@ static bool sensorMgrTask_SendOSALMsg( uint8 destTaskID, sensorMgrTask_msg_t msg
 
 static uint8                       sensorMgrTask_TaskID;                               // Task ID for internal task/event processing
 
-static sensorDatColl_t             sensorDatColl = 
+// Onboard sensors, registered in this order by sensorMgrTask_Init
+static const sensorDesc_t          MS560702_sensorDesc = 
+{
+  .init = sensorMgrTask_initBarometer,
+  .startConv = MS560702_startConv,
+  .fetch = MS560702_fetch,
+  .convTime = MS560702_convTime,
+  .getPeriod = MS560702Mgr_getSamplePeriod,
+  .getSig = MS560702_getSig,
+  .stuckLimit = SENSORMGR_BARO_STUCK_LIMIT,
+  .period = SENSORMGR_BARO_PERIOD,
+  .pwrClass = SENSOR_PWR_MOTION,
+};
+
+static const sensorDesc_t          MMA8453_sensorDesc = 
 {
-  .nextSensor = FALSE,
-  .currSensor = 0,
-  .numSensors = SENSORMGR_MAX_NUM_SENSORS,
+  .init = MMA8453_init,
+  .fetch = MMA8453_fetch,
+  .getPeriod = MMA8453_getPeriod,
+  .period = SENSORMGR_ACCEL_PERIOD,
+  .pwrClass = SENSOR_PWR_ALWAYS,
 };
 
-// Sensor Data Collection Function Table
-sensorDatCollFncTbl_t       sensorDatCollFncTbl[SENSORMGR_MAX_NUM_SENSORS] = 
+static const sensorDesc_t          MSPFG_sensorDesc = 
 {
-  MS560702_dataCollector,
-  MMA8453_dataCollector
+  .init = MSPFG_init,
+  .suspend = MSPFG_suspend,
+  .fetch = MSPFG_fetch,
+  .period = SENSORMGR_FUEL_PERIOD,
+  .pwrClass = SENSOR_PWR_MOTION,
 };
 
+// Sensor Data Collection Schedule, one slot per registered sensor
+static sensorSched_t               sensorSchedTbl[SENSORMGR_MAX_NUM_SENSORS];
+static uint8                       sensorSchedNum = 0;
+
+static bool                        sensorSweepActive = FALSE;                          // Collector is clearing due work
+static uint32                      sensorSweepStart;                                   // System clock (ms) the sweep began
+
+// Operating profile state, see sensorMgrTask_applyOpProfile
+static uint8                       sensorClassMask = OPPROFILE_SENSORS_ALWAYS | OPPROFILE_SENSORS_MOTION;
+static bool                        sensorRpmEnabled = TRUE;
+static bool                        sensorMotionSeen = FALSE;                           // Accel transient since the last detector pass
+
+static bool                        mspfgMeasured = FALSE;                              // Fuel gauge measurement read since MSPFG_init
+
 ////////////////////////////////////////////////////////////////////////////////
 // API FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +144,182 @@ uint8 sensorMgrTask_getTaskId( void )
   
 } // sensorMgrTask_getTaskId
 
+// Adds a sensor to the schedule. Register before the sensors are initialized,
+// i.e. from a task init function. Returns the sensor's slot, SENSORMGR_SENSOR_NONE
+// if the registry is full.
+uint8 sensorMgrTask_registerSensor( const sensorDesc_t *pDesc )
+{
+  if( sensorSchedNum >= SENSORMGR_MAX_NUM_SENSORS )
+    return SENSORMGR_SENSOR_NONE;
+  
+  sensorSched_t *pSched = &sensorSchedTbl[sensorSchedNum];
+  VOID memset( pSched, 0, sizeof( sensorSched_t ) );
+  pSched->pDesc = pDesc;
+  pSched->period = pDesc->period;
+  
+  return sensorSchedNum++;
+  
+} // sensorMgrTask_registerSensor
+
+// Returns SENSORMGR_HEALTH_FAULT and SENSORMGR_HEALTH_OFFLINE bits of every slot
+uint16 sensorMgrTask_getHealth( void )
+{
+  uint16 health = 0;
+  for( uint8 i = 0; i < sensorSchedNum; i++ )
+  {
+    if( sensorSchedTbl[i].offline )
+      health |= SENSORMGR_HEALTH_OFFLINE( i );
+    if( sensorSchedTbl[i].failCnt || sensorSchedTbl[i].reinitCnt )
+      health |= SENSORMGR_HEALTH_FAULT( i );
+  }
+  return health;
+  
+} // sensorMgrTask_getHealth
+
+// Applies a new fuel tilt correction coefficient set and persists it
+bool sensorMgrTask_setFuelTiltCoeff( mujoeFuelTiltCoeff_t *pCoeff )
+{
+  mujoeFuelTilt_setCoeff( pCoeff );
+  return CAT24C512_writeRecord( EEPROM_PAGE_FUEL_TILT_COEFF, FUELTILT_RECORD_KEY, 
+                                (uint8 *)pCoeff, sizeof( mujoeFuelTiltCoeff_t ) );
+  
+} // sensorMgrTask_setFuelTiltCoeff
+
+// Takes the current attitude as level for the fuel tilt correction and persists it.
+// Call with the aircraft sat level.
+bool sensorMgrTask_setFuelTiltLevelRef( void )
+{
+  int16 grav[MMA_NUM_AXES];
+  mujoeFuelTiltCoeff_t coeff;
+  
+  MMA8453QMgr_getGravity( grav );
+  mujoeFuelTilt_setLevelRef( grav );
+  mujoeFuelTilt_getCoeff( &coeff );
+  return CAT24C512_writeRecord( EEPROM_PAGE_FUEL_TILT_COEFF, FUELTILT_RECORD_KEY, 
+                                (uint8 *)&coeff, sizeof( mujoeFuelTiltCoeff_t ) );
+  
+} // sensorMgrTask_setFuelTiltLevelRef
+
+// Starts accelerometer offset calibration. The unit must be at rest with one
+// axis vertical; the result is programmed and persisted once enough samples
+// are in, and the outcome is reported to the mainTask.
+void sensorMgrTask_startAccelCal( void )
+{
+  MMA8453QMgr_startOffsetCal();
+  
+} // sensorMgrTask_startAccelCal
+
+// Erases the stored black box events
+bool sensorMgrTask_clearBlackBox( void )
+{
+  return mujoeBlackBox_clear();
+  
+} // sensorMgrTask_clearBlackBox
+
+// Sets the time to empty alert thresholds (min, descending)
+bool sensorMgrTask_setFuelTteThresholds( uint16 *pThresh )
+{
+  return mujoeFuelBurn_setThresholds( pThresh );
+  
+} // sensorMgrTask_setFuelTteThresholds
+
+// Starts a tank calibration, the current table stays in use until it is saved
+void sensorMgrTask_startTankCal( void )
+{
+  mujoeTankLut_startCal();
+  
+} // sensorMgrTask_startTankCal
+
+// Records the latest fuel gauge capacitance as the tank holding "vol" (mL)
+bool sensorMgrTask_addTankCalPoint( uint16 vol )
+{
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  
+  // Nothing read from the gauge yet
+  if( pDat->fuelSnap.capAlgo == 0 )
+    return FALSE;
+  
+  return mujoeTankLut_addCalPoint( pDat->fuelSnap.capAlgo, vol );
+  
+} // sensorMgrTask_addTankCalPoint
+
+// Activates the calibrated tank table and persists it
+bool sensorMgrTask_finishTankCal( void )
+{
+  mujoeTankLutTbl_t *pTbl = mujoeTankLut_finishCal();
+  if( pTbl == NULL )
+    return FALSE;
+  
+  // The gauge's threshold follows the new table
+  bool stored = CAT24C512_writeRecord( EEPROM_PAGE_TANK_LUT, TANKLUT_RECORD_KEY, 
+                                       (uint8 *)pTbl, sizeof( mujoeTankLutTbl_t ) );
+  return ( MSPFG_programCritThresh() && stored ) ? TRUE : FALSE;
+  
+} // sensorMgrTask_finishTankCal
+
+// Sets the critical fuel level threshold (%) and programs it into the gauge.
+// The previous threshold stays if the gauge does not take it.
+bool sensorMgrTask_setFuelCritThresh( uint8 thresh )
+{
+  uint8 prev = brdSensorDat.ppgfg.fuelCritThresh;
+  
+  brdSensorDat.ppgfg.fuelCritThresh = thresh;
+  if( MSPFG_programCritThresh() )
+    return TRUE;
+  
+  brdSensorDat.ppgfg.fuelCritThresh = prev;
+  return FALSE;
+  
+} // sensorMgrTask_setFuelCritThresh
+
+// Streams the raw and algo capacitances of every gauge measurement to the Async
+// Bulk characteristic in place of the normal packet, see mujoeFuelCap.h. The
+// capture skips the level pipeline and with it the critical fuel alarm, so it
+// is refused unless the ground profile is active.
+bool sensorMgrTask_startFuelCapture( void )
+{
+  if( mujoeOpProfile_getActive() != OPPROFILE_GROUND )
+    return FALSE;
+  
+  mujoeFuelCap_start( mujoeTimestamp_now() );
+  return TRUE;
+  
+} // sensorMgrTask_startFuelCapture
+
+void sensorMgrTask_stopFuelCapture( void )
+{
+  mujoeFuelCap_stop();
+  
+} // sensorMgrTask_stopFuelCapture
+
+// Selects an operating profile, or OPPROFILE_AUTO, and has the mainTask apply it
+bool sensorMgrTask_selectOpProfile( uint8 sel )
+{
+  if( !mujoeOpProfile_select( sel ) )
+    return FALSE;
+  
+  return sensorMgrTask_SendOSALMsg( mainTask_getTaskId(), SENSORMGR_OPPROFILE_CHANGE );
+  
+} // sensorMgrTask_selectOpProfile
+
+// Applies the sensor side of an operating profile: accel configuration,
+// barometer OSR and rate limits, RPM estimation and the scheduled classes.
+// Sensors whose class is dropped are suspended and parked, ones whose class
+// returns are resumed and made due straight away.
+void sensorMgrTask_applyOpProfile( const mujoeOpProfileCfg_t *pCfg )
+{
+  uint8 wasEnabled = sensorMgrTask_schedEnabledMask();
+  
+  VOID MMA8453QMgr_applyProfile( pCfg->accelProfile );
+  MS560702Mgr_setLimits( pCfg->baroMaxOsrLvl, pCfg->baroMinPeriod );
+  sensorRpmEnabled = pCfg->rpm;
+  sensorClassMask = pCfg->sensors;
+  
+  // Reschedule with the new periods
+  sensorMgrTask_schedPower( wasEnabled );
+  
+} // sensorMgrTask_applyOpProfile
+
 /*********************************************************************
  * @fn      sensorMgrTask_Init
  *
@@ -100,10 +339,24 @@ void sensorMgrTask_Init( uint8 task_id )
   sensorMgrTask_TaskID = task_id;
   
   MS560702_initDriver(FALSE);   // Init BAR Drivers, CSB = GND
-  bool stat = CAT24C512_initDriver( 64, FALSE, FALSE, FALSE );
+  bool stat = CAT24C512_initDriver( CAT24C512_BUFF_SIZE, FALSE, FALSE, FALSE );
   while( !stat );               // TRAP MCU if init failed
   stat = MMA8453Q_initDriver( 10, FALSE );
   while( !stat );               // TRAP MCU if init failed
+  
+  mujoeTimestamp_init();
+  mujoeVario_init();
+  mujoeSampleRing_init();
+  MS560702Mgr_init();
+  mujoeFuelEst_init();
+  mujoeFuelBurn_init();
+  mujoeOpProfile_init();
+  brdSensorDat.ppgfg.fuelTte = FUELBURN_TTE_UNKNOWN;
+  brdSensorDat.ppgfg.fuelCritThresh = SENSORMGR_FUEL_CRIT_THRESH;
+  
+  VOID sensorMgrTask_registerSensor( &MS560702_sensorDesc );
+  VOID sensorMgrTask_registerSensor( &MMA8453_sensorDesc );
+  VOID sensorMgrTask_registerSensor( &MSPFG_sensorDesc );
 
 } // sensorMgrTask_Init
 
@@ -146,7 +399,9 @@ uint16 sensorMgrTask_ProcessEvent( uint8 task_id, uint16 events )
   {
     bool stat = sensorMgrTask_initSensors();
     while( !stat );     // Trap MCU if failure
-    //osal_set_event( sensorMgrTask_TaskID, SENSORMGR_DATA_COLLECTOR_EVT );       // TEST
+    osal_set_event( sensorMgrTask_TaskID, SENSORMGR_DATA_COLLECTOR_EVT );
+    osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT, SENSORMGR_RPM_PERIOD );
+    osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_OPPROFILE_EVT, SENSORMGR_OPPROFILE_PERIOD );
     return (events ^ SENSORMGR_INIT_SENSORS_EVT);
   }
   
@@ -156,6 +411,37 @@ uint16 sensorMgrTask_ProcessEvent( uint8 task_id, uint16 events )
     sensorMgrTask_dataCollector();
     return (events ^ SENSORMGR_DATA_COLLECTOR_EVT);
   }
+  
+  // Accelerometer Offset Calibration Event ////////////////////////////////////
+  if( events & SENSORMGR_ACCEL_CAL_EVT )
+  {
+    sensorMgrTask_finishAccelCal();
+    return (events ^ SENSORMGR_ACCEL_CAL_EVT);
+  }
+  
+  // Engine RPM Estimator Event ////////////////////////////////////////////////
+  if( events & SENSORMGR_RPM_EVT )
+  {
+    sensorMgrTask_rpmEstimator();
+    return (events ^ SENSORMGR_RPM_EVT);
+  }
+  
+  // Black Box Writer Event ////////////////////////////////////////////////////
+  if( events & SENSORMGR_BBOX_EVT )
+  {
+    // One chunk per event, the collector has the bus while the EEPROM writes it
+    if( !mujoeBlackBox_writeSlice() )
+      osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_BBOX_EVT, CAT24C512_WRITE_CYCLE_TIME );
+    return (events ^ SENSORMGR_BBOX_EVT);
+  }
+  
+  // Flight State Detector Event ///////////////////////////////////////////////
+  if( events & SENSORMGR_OPPROFILE_EVT )
+  {
+    sensorMgrTask_opProfileDetect();
+    osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_OPPROFILE_EVT, SENSORMGR_OPPROFILE_PERIOD );
+    return (events ^ SENSORMGR_OPPROFILE_EVT);
+  }
 
   // Discard unknown events
   return 0;
@@ -166,101 +452,686 @@ uint16 sensorMgrTask_ProcessEvent( uint8 task_id, uint16 events )
 // STATIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
 
+// Earliest deadline first over job starts and resumes alike: a job that waits
+// out a conversion gives up the collector, so the wait is filled with whatever
+// else is due. Everything is driven by the one DATA_COLLECTOR timer.
 static void sensorMgrTask_dataCollector( void )
 {
-  // Call the current sensor within the queu data collection fnc
-  if( sensorDatColl.currSensor < sensorDatColl.numSensors )
-    sensorDatCollFncTbl[sensorDatColl.currSensor](&sensorDatColl);
+  if( sensorSchedNum == 0 )
+    return;
   
-  if( sensorDatColl.nextSensor )
+  // Runs at least every SENSORMGR_PARKED_PERIOD, well within the sleep timer
+  // wrap, so stamps keep their rollover count even with every sensor parked
+  VOID mujoeTimestamp_now();
+  
+  sensorSched_t *pSched = &sensorSchedTbl[sensorMgrTask_schedEarliest()];
+  
+  if( (int32)( pSched->due - osal_GetSystemClock() ) <= 0 )
   {
-    sensorDatColl.currSensor++;
-    // If end of sensor queue reached, restart
-    if( sensorDatColl.currSensor == sensorDatColl.numSensors )  
-      sensorDatColl.currSensor = 0;
-    
-    // Reset sensor specific state machine var
-    sensorDatColl.sensorState = 0;
-    sensorDatColl.sensorFlags = 0;
-    VOID memset( &(sensorDatColl.evtCb), 0, sizeof( evtCallback_t ) );
-    
-    sensorDatColl.nextSensor = FALSE;
+    if( !sensorSweepActive )
+    {
+      sensorSweepActive = TRUE;
+      sensorSweepStart = osal_GetSystemClock();
+    }
+    sensorMgrTask_schedRun( pSched );
   }
   
-  // Schedule next event to continue data collection
-  if( sensorDatColl.evtCb.delay )
+  // Sleep until the next start or resume
+  pSched = &sensorSchedTbl[sensorMgrTask_schedEarliest()];
+  int32 wait = (int32)( pSched->due - osal_GetSystemClock() );
+  if( wait > 0 )
   {
-    osal_start_timerEx( sensorMgrTask_TaskID, 
-                        SENSORMGR_DATA_COLLECTOR_EVT, 
-                        sensorDatColl.evtCb.delay );
-    sensorDatColl.evtCb.delay = 0;
+    // Sweep is over once nothing is due and no job is waiting on a conversion
+    if( sensorSweepActive && !sensorMgrTask_schedBusy() )
+    {
+      sensorSweepActive = FALSE;
+      brdSensorDat.ppgfg.sweepPeriod = (uint16)( osal_GetSystemClock() - sensorSweepStart );
+    }
+    osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_DATA_COLLECTOR_EVT, (uint32)wait );
   }
   else
     osal_set_event( sensorMgrTask_TaskID, SENSORMGR_DATA_COLLECTOR_EVT );
   
 } // sensorMgrTask_dataCollector
 
-static void MS560702_dataCollector( p_sensorDatColl_t sdc )
-{
-   switch( sdc->sensorState )
-   {
-     // Trigger Pressure Conversion
-     case 0:
-       if( sdc->sensorFlags & 0x01 )
-         MS560702_trigTemperatureConv( MS5_OSR_4096 );
-       else
-         MS560702_trigPressureConv( MS5_OSR_4096 );
-       sdc->evtCb.delay = 100;
-       sdc->sensorState = 1;  
-       break;
-     // Poll and fetch Conversion
-     case 1:
-     {
-        uint32 adcConv;
-        if( MS560702_readAdcConv( &adcConv ) )
-        {
-            if( sdc->sensorFlags & 0x01 )
-            {
-              brdSensorDat.ppgfg.barTempCode = adcConv;
-              sdc->nextSensor = TRUE;
-            }
-            else
-            {
-              brdSensorDat.ppgfg.barPresCode = adcConv;
-              sdc->sensorFlags |= 0x01;
-              sdc->sensorState = 0;
-            }
-        }
-        else
-        {
-          sdc->sensorState = 1;
-          sdc->evtCb.delay = 100;
-        }
-        break;
-     }
-     default:
+// Advances the slot's job by one step: skip, start a conversion or fetch
+static void sensorMgrTask_schedRun( sensorSched_t *pSched )
+{
+  const sensorDesc_t *pDesc = pSched->pDesc;
+  uint32 now = osal_GetSystemClock();
+  
+  if( !pSched->busy )
+  {
+    if( !sensorMgrTask_schedEnabled( pSched ) )
+    {
+      sensorMgrTask_schedFinish( pSched, now );
+      return;
+    }
+    // Offline sensors only get a re-init probe. One that answers is back on
+    // probation: a single failed escalation round takes it offline again.
+    if( pSched->offline )
+    {
+      if( ( pDesc->init != NULL ) && pDesc->init() )
+        pSched->offline = FALSE;
+      sensorMgrTask_schedFinish( pSched, osal_GetSystemClock() );
+      return;
+    }
+    pSched->busy = TRUE;
+    pSched->converting = FALSE;
+    pSched->step = 0;
+    pSched->retryCnt = 0;
+  }
+  
+  uint8 convTime = ( pDesc->convTime != NULL ) ? pDesc->convTime() : 0;
+  
+  if( !pSched->converting && ( pDesc->startConv != NULL ) )
+  {
+    if( !pDesc->startConv( pSched->step ) )
+    {
+      sensorMgrTask_healthFail( pSched );
+      sensorMgrTask_schedFinish( pSched, now );
+      return;
+    }
+    pSched->converting = TRUE;
+    pSched->due = now + convTime;
+    return;
+  }
+  
+  switch( pDesc->fetch( pSched->step ) )
+  {
+    case SENSOR_FETCH_CONVERT:
+      pSched->step++;
+      pSched->converting = FALSE;
+      pSched->due = osal_GetSystemClock();
+      break;
+    case SENSOR_FETCH_RETRY:
+      if( ++pSched->retryCnt <= SENSORMGR_HEALTH_MAX_RETRIES )
+      {
+        pSched->due = osal_GetSystemClock() + ( convTime ? convTime : 1 );
         break;
-   }
-   
-} // MS560702_dataCollector
+      }
+      sensorMgrTask_healthFail( pSched );
+      sensorMgrTask_schedFinish( pSched, osal_GetSystemClock() );
+      break;
+    case SENSOR_FETCH_FAIL:
+      sensorMgrTask_healthFail( pSched );
+      sensorMgrTask_schedFinish( pSched, osal_GetSystemClock() );
+      break;
+    case SENSOR_FETCH_PENDING:
+      sensorMgrTask_schedFinish( pSched, osal_GetSystemClock() );
+      break;
+    default:
+      if( pDesc->getOutput != NULL )
+        mujoeSampleRing_pushAux( mujoeTimestamp_now(), (uint8)( pSched - sensorSchedTbl ), pDesc->getOutput() );
+      sensorMgrTask_healthPass( pSched );
+      sensorMgrTask_schedFinish( pSched, osal_GetSystemClock() );
+      break;
+  }
+  
+} // sensorMgrTask_schedRun
 
-static void MMA8453_dataCollector( p_sensorDatColl_t sdc )
+// Closes the slot's job and sets its next deadline, at a fixed rate and
+// restarted from now if a whole period was missed
+static void sensorMgrTask_schedFinish( sensorSched_t *pSched, uint32 now )
 {
-  // Add data colleciton state machine
+  if( pSched->pDesc->getPeriod != NULL )
+    pSched->period = pSched->pDesc->getPeriod();
+  
+  uint16 period = pSched->period;
+  if( !sensorMgrTask_schedEnabled( pSched ) )
+    period = SENSORMGR_PARKED_PERIOD;
+  else if( pSched->offline )
+    period = SENSORMGR_HEALTH_PROBE_PERIOD;
+  pSched->deadline += period;
+  if( (int32)( now - pSched->deadline ) >= 0 )
+    pSched->deadline = now + period;
+  pSched->due = pSched->deadline;
+  pSched->busy = FALSE;
   
-} // MMA8453_dataCollector
+} // sensorMgrTask_schedFinish
 
-static bool sensorMgrTask_initSensors( void )
+// A completed job, unless its raw value has not changed for stuckLimit samples
+static void sensorMgrTask_healthPass( sensorSched_t *pSched )
 {
-  // Init Barometer IC
-  if( !MS560702_initHardware() )
+  const sensorDesc_t *pDesc = pSched->pDesc;
+  
+  if( pDesc->getSig != NULL )
+  {
+    uint32 sig = pDesc->getSig();
+    if( sig != pSched->lastSig )
+    {
+      pSched->lastSig = sig;
+      pSched->stuckCnt = 0;
+    }
+    else if( ++pSched->stuckCnt >= pDesc->stuckLimit )
+    {
+      pSched->stuckCnt = 0;
+      sensorMgrTask_healthFail( pSched );
+      return;
+    }
+  }
+  
+  pSched->failCnt = 0;
+  pSched->reinitCnt = 0;
+  
+} // sensorMgrTask_healthPass
+
+// Escalates a failed job: retry on the next period, then driver re-init, then offline
+static void sensorMgrTask_healthFail( sensorSched_t *pSched )
+{
+  if( ++pSched->failCnt < SENSORMGR_HEALTH_REINIT_FAILS )
+    return;
+  
+  pSched->failCnt = 0;
+  if( ++pSched->reinitCnt > SENSORMGR_HEALTH_MAX_REINITS )
+  {
+    pSched->reinitCnt = SENSORMGR_HEALTH_MAX_REINITS;
+    pSched->offline = TRUE;
+    return;
+  }
+  
+  if( pSched->pDesc->init != NULL )
+    VOID pSched->pDesc->init();
+  
+} // sensorMgrTask_healthFail
+
+// Returns the schedule slot due soonest
+static uint8 sensorMgrTask_schedEarliest( void )
+{
+  uint8 earliest = 0;
+  for( uint8 i = 1; i < sensorSchedNum; i++ )
+  {
+    if( (int32)( sensorSchedTbl[i].due - sensorSchedTbl[earliest].due ) < 0 )
+      earliest = i;
+  }
+  return earliest;
+  
+} // sensorMgrTask_schedEarliest
+
+// Returns TRUE if any job is waiting on a delay
+static bool sensorMgrTask_schedBusy( void )
+{
+  for( uint8 i = 0; i < sensorSchedNum; i++ )
+  {
+    if( sensorSchedTbl[i].busy )
+      return TRUE;
+  }
+  return FALSE;
+  
+} // sensorMgrTask_schedBusy
+
+// Returns TRUE if the operating profile schedules the slot's class and, for the
+// motion class, the airframe is not stationary (accel auto-sleep)
+static bool sensorMgrTask_schedEnabled( sensorSched_t *pSched )
+{
+  sensorPwrClass_t pwrClass = pSched->pDesc->pwrClass;
+  
+  if( !( sensorClassMask & ( 0x01 << pwrClass ) ) )
     return FALSE;
-  // Init Accelerometer IC
-  if( !MMA845Q_initHardware() )
+  return ( ( pwrClass == SENSOR_PWR_MOTION ) && MMA8453QMgr_isSleeping() ) ? FALSE : TRUE;
+  
+} // sensorMgrTask_schedEnabled
+
+// Returns sensorMgrTask_schedEnabled of every slot, bit per slot
+static uint8 sensorMgrTask_schedEnabledMask( void )
+{
+  uint8 mask = 0;
+  for( uint8 i = 0; i < sensorSchedNum; i++ )
+  {
+    if( sensorMgrTask_schedEnabled( &sensorSchedTbl[i] ) )
+      mask |= 0x01 << i;
+  }
+  return mask;
+  
+} // sensorMgrTask_schedEnabledMask
+
+// Follows up a change of profile or sleep state, "wasEnabled" being
+// sensorMgrTask_schedEnabledMask from before it. Slots that stop being
+// scheduled are suspended, ones that start again are resumed with their init
+// and made due straight away, then the collector is woken.
+static void sensorMgrTask_schedPower( uint8 wasEnabled )
+{
+  for( uint8 i = 0; i < sensorSchedNum; i++ )
+  {
+    sensorSched_t *pSched = &sensorSchedTbl[i];
+    const sensorDesc_t *pDesc = pSched->pDesc;
+    bool was = ( wasEnabled & ( 0x01 << i ) ) ? TRUE : FALSE;
+    bool now = sensorMgrTask_schedEnabled( pSched );
+    
+    if( was && !now )
+    {
+      if( pDesc->suspend != NULL )
+        pDesc->suspend();
+    }
+    else if( !was && now )
+    {
+      if( ( pDesc->suspend != NULL ) && ( pDesc->init != NULL ) && !pSched->offline )
+        VOID pDesc->init();
+      if( !pSched->busy )
+      {
+        pSched->deadline = osal_GetSystemClock();
+        pSched->due = pSched->deadline;
+      }
+    }
+  }
+  
+  osal_stop_timerEx( sensorMgrTask_TaskID, SENSORMGR_DATA_COLLECTOR_EVT );
+  osal_set_event( sensorMgrTask_TaskID, SENSORMGR_DATA_COLLECTOR_EVT );
+  
+} // sensorMgrTask_schedPower
+
+// Step 0 converts pressure, step 1 temperature. The pressure sample is stamped
+// with the moment its conversion completes, however late it is fetched.
+static bool MS560702_startConv( uint8 step )
+{
+  MS560702_osr_t osr = MS560702Mgr_getOsr();
+  
+  if( step != 0 )
+    return MS560702_trigTemperatureConv( osr );
+  
+  uint32 timestamp = mujoeTimestamp_now();
+  if( !MS560702_trigPressureConv( osr ) )
     return FALSE;
-  // Init EEPROM IC
+  brdSensorDat.ppgfg.barTimestamp = timestamp + mujoeTimestamp_msToTicks( MS560702_getConvTime( osr ) );
+  return TRUE;
+  
+} // MS560702_startConv
+
+static sensorFetch_t MS560702_fetch( uint8 step )
+{
+  uint32 adcConv;
+  if( !MS560702_readAdcConv( &adcConv ) )
+    return SENSOR_FETCH_RETRY;
+  
+  if( step == 0 )
+  {
+    brdSensorDat.ppgfg.barPresCode = adcConv;
+    return SENSOR_FETCH_CONVERT;
+  }
+  
+  brdSensorDat.ppgfg.barTempCode = adcConv;
+  return MS560702_processSample() ? SENSOR_FETCH_DONE : SENSOR_FETCH_FAIL;
+  
+} // MS560702_fetch
+
+static uint8 MS560702_convTime( void )
+{
+  return MS560702_getConvTime( MS560702Mgr_getOsr() );
+  
+} // MS560702_convTime
+
+static uint32 MS560702_getSig( void )
+{
+  return brdSensorDat.ppgfg.barPresCode;
+  
+} // MS560702_getSig
+
+// Compensates the latest pressure/temperature pair and feeds the variometer.
+// Returns FALSE, leaving the previous sample in place, if the pair is unusable.
+static bool MS560702_processSample( void )
+{
+  static mujoeTimestampDt_t baroDt = { 0 };
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  int32 pres, temp;
+  
+  if( !MS560702_calcCompensated( pDat->barPresCode, pDat->barTempCode, &pres, &temp ) ||
+      ( pres < SENSORMGR_BARO_MIN_PRES ) || ( pres > SENSORMGR_BARO_MAX_PRES ) )
+    return FALSE;
+  pDat->barPressure = pres;
+  pDat->barTemperature = temp;
+  
+  mujoeSampleRing_pushBaro( pDat->barTimestamp, pDat->barPressure, (int16)pDat->barTemperature );
+  MS560702Mgr_update( pDat->barPressure );
+  mujoeVario_baroUpdate( mujoeVario_pressureToAltitude( pDat->barPressure ), 
+                         mujoeTimestamp_takeDtMs( &baroDt, pDat->barTimestamp ) );
+  
+  return TRUE;
+  
+} // MS560702_processSample
+
+// Samples are read on DRDY by MMA8453_drdyIntHdlr. The fetch drains them
+// every MMAMGR_DRAIN_PERIOD ms as one averaged sample.
+static sensorFetch_t MMA8453_fetch( uint8 step )
+{
+  VOID step; // Single step job
+  
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  
+  // INT1/INT2 are edge triggered and stay asserted until their source is read,
+  // so a missed edge would stall them. Service anything left pending.
+  if( muJoeGPIO_readPin( PINID_ACCEL_INT1 ) == FALSE )
+    MMA8453_drdyIntHdlr();
+  if( muJoeGPIO_readPin( PINID_ACCEL_INT2 ) == FALSE )
+    MMA8453_motionIntHdlr();
+  
+  bool newSample = MMA8453QMgr_popAverage( pDat->accXYZ );
+  if( newSample )
+  {
+    static mujoeTimestampDt_t accDt = { 0 };
+    mujoeSampleRing_pushAccel( pDat->accTimestamp, pDat->accXYZ );
+    MMA8453_processSample( mujoeTimestamp_takeDtMs( &accDt, pDat->accTimestamp ) );
+  }
+  sensorMgrTask_blackBoxSample();
+  
+  // The drain period follows the ODR, so an empty drain means DRDY has stopped
+  return newSample ? SENSOR_FETCH_DONE : SENSOR_FETCH_FAIL;
+  
+} // MMA8453_fetch
+
+// In auto-sleep samples arrive at the sleep ODR, drain no faster than that
+static uint16 MMA8453_getPeriod( void )
+{
+  uint16 period = MMA8453QMgr_getSamplePeriod();
+  return ( period > MMAMGR_DRAIN_PERIOD ) ? period : MMAMGR_DRAIN_PERIOD;
+  
+} // MMA8453_getPeriod
+
+// ACCEL_INT1 callback: burst reads the new sample so the part can assert DRDY again
+static void MMA8453_drdyIntHdlr( void )
+{
+  uint32 timestamp = muJoeGPIO_getEdgeTimestamp();
+  int16 xyz[MMA_NUM_AXES];
+  if( !MMA8453Q_readXYZ( xyz, &brdSensorDat.ppgfg.accStatus ) || 
+      !( brdSensorDat.ppgfg.accStatus & MMA_STATUS_ZYXDR ) )
+    return;
+  
+  MMA8453QMgr_pushSample( xyz, brdSensorDat.ppgfg.accStatus );
+  brdSensorDat.ppgfg.accTimestamp = timestamp;
+  
+  if( MMA8453QMgr_accumOffsetCal( xyz ) )
+    osal_set_event( sensorMgrTask_TaskID, SENSORMGR_ACCEL_CAL_EVT );
+  
+  // Feed the RPM capture block with gravity removed
+  if( mujoeRpm_isCapturing() )
+  {
+    int16 grav[MMA_NUM_AXES];
+    MMA8453QMgr_getGravity( grav );
+    for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+      xyz[i] -= grav[i];
+    
+    if( mujoeRpm_addSample( xyz, timestamp ) )
+    {
+      VOID MMA8453QMgr_setHighRate( FALSE );
+      osal_stop_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT );
+      osal_set_event( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT );
+    }
+  }
+  
+} // MMA8453_drdyIntHdlr
+
+// ACCEL_INT2 callback: auto-sleep entry/exit and transient (motion) events.
+// Motion class sensors are suspended on sleep entry. On wake they are resumed,
+// made due and the collector woken so they restart straight away instead of
+// after the sleep drain period.
+static void MMA8453_motionIntHdlr( void )
+{
+  uint32 timestamp = muJoeGPIO_getEdgeTimestamp();
+  bool wasSleeping = MMA8453QMgr_isSleeping();
+  uint8 wasEnabled = sensorMgrTask_schedEnabledMask();
+  
+  if( !MMA8453QMgr_updateSysMode() )
+    return;
+  
+  if( !MMA8453QMgr_isSleeping() )
+    sensorMotionSeen = TRUE;
+  
+  uint8 impactSrc = MMA8453QMgr_takeImpact();
+  if( impactSrc )
+    mujoeBlackBox_trigger( timestamp, impactSrc );
+  
+  if( wasSleeping != MMA8453QMgr_isSleeping() )
+    sensorMgrTask_schedPower( wasEnabled );
+  
+} // MMA8453_motionIntHdlr
+
+// Runs a new XYZ sample through the accel manager and feeds the fused outputs
+static void MMA8453_processSample( uint16 dtMs )
+{
+  MMA8453QMgr_processSample( brdSensorDat.ppgfg.accXYZ );
+  mujoeBlackBox_accelUpdate( brdSensorDat.ppgfg.accXYZ );
+  mujoeVario_accelUpdate( MMA8453QMgr_getVertAccel(), dtMs );
+  MS560702Mgr_updateAccelActivity( MMA8453QMgr_getActivity() );
+  
+} // MMA8453_processSample
+
+// Pushes a black box ring sample every BBOX_SAMPLE_PERIOD and starts writing the
+// event out once its post-trigger window is complete
+static void sensorMgrTask_blackBoxSample( void )
+{
+  static uint32 lastTimestamp = 0;
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  uint32 now = osal_GetSystemClock();
+  
+  if( ( now - lastTimestamp ) < BBOX_SAMPLE_PERIOD )
+    return;
+  lastTimestamp = now;
+  
+  if( mujoeBlackBox_addSample( pDat->barPressure, mujoeVario_getVerticalSpeed(), 
+                               (uint8)( pDat->fuelLvl / 100 ) ) )
+    osal_set_event( sensorMgrTask_TaskID, SENSORMGR_BBOX_EVT );
+  
+} // sensorMgrTask_blackBoxSample
+
+// The fuel gauge streams in continuous mode and measurements are fetched by
+// MSPFG_dataRdyIntHdlr. The fetch only services a missed edge, read if MSP_INT
+// is still low, and reports the gauge as failed once it has gone quiet, so the
+// health monitor re-inits it.
+// Only a measurement read since MSPFG_init counts as good, until the first one
+// arrives the job is left pending for up to SENSORMGR_FUEL_TIMEOUT.
+static sensorFetch_t MSPFG_fetch( uint8 step )
+{
+  VOID step; // Single step job
+  
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  
+  if( muJoeGPIO_readPin( PINID_MSP_INT ) == FALSE )
+    MSPFG_dataRdyIntHdlr();
+  
+  bool overdue = ( ( mujoeTimestamp_now() - pDat->fuelTimestamp ) >= mujoeTimestamp_msToTicks( SENSORMGR_FUEL_TIMEOUT ) ) ? TRUE : FALSE;
+  if( !mspfgMeasured )
+    return overdue ? SENSOR_FETCH_FAIL : SENSOR_FETCH_PENDING;
+  
+  if( overdue || ( pDat->fuelSnap.fuelLvl > MSPFG_FUEL_LVL_MAX ) )
+    return SENSOR_FETCH_FAIL;
+  
+  return SENSOR_FETCH_DONE;
+  
+} // MSPFG_fetch
+
+// MSP_INT callback: fetches the new measurement, corrects it for the frame's
+// attitude and runs it through the slosh filter, or packs its capacitances while
+// a capture is running. Every edge is read, whether MSP_INT is still asserted by
+// the time the callback runs or was only pulsed.
+static void MSPFG_dataRdyIntHdlr( void )
+{
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  uint32 timestamp = muJoeGPIO_getEdgeTimestamp();
+  
+  // Capture mode skips the level pipeline so nothing but the capacitance burst
+  // stands between measurements
+  if( mujoeFuelCap_isActive() )
+  {
+    if( mspfg_readCaps( &pDat->fuelSnap.capAlgo, &pDat->fuelSnap.capRaw ) )
+    {
+      mspfgMeasured = TRUE;
+      pDat->fuelTimestamp = timestamp;
+      if( mujoeFuelCap_addSample( timestamp, pDat->fuelSnap.capRaw, pDat->fuelSnap.capAlgo ) )
+        osal_set_event( mainTask_getTaskId(), MAIN_FUEL_CAPTURE_EVT );
+    }
+    return;
+  }
+  
+  if( mspfg_readSnapshot( &pDat->fuelSnap ) )
+  {
+    // With a tank table the level comes from the measured volume, otherwise
+    // from the gauge's own linear CAP_FULL mapping
+    int16 lvl = (int16)pDat->fuelSnap.fuelLvl * 100;
+    if( mujoeTankLut_isValid() )
+    {
+      pDat->fuelVol = mujoeTankLut_capToVolume( pDat->fuelSnap.capAlgo );
+      lvl = (int16)( ( (uint32)pDat->fuelVol * FUELTILT_LVL_MAX ) / mujoeTankLut_getFullVolume() );
+    }
+    MSPFG_checkCritLevel( lvl );
+    
+    int16 grav[MMA_NUM_AXES];
+    MMA8453QMgr_getGravity( grav );
+    pDat->fuelLvl = mujoeFuelTilt_correct( lvl, grav );
+    mujoeFuelEst_update( pDat->fuelLvl, MMA8453QMgr_getActivity() );
+    pDat->fuelLvlFilt = mujoeFuelEst_getLevel();
+    pDat->fuelConf = mujoeFuelEst_getConfidence();
+    mspfgMeasured = TRUE;
+    pDat->fuelTimestamp = timestamp;
+    mujoeSampleRing_pushFuel( pDat->fuelTimestamp, pDat->fuelLvlFilt, pDat->fuelConf );
+    
+    // Burn regression runs on the filtered level at its own, slower rate
+    if( ( pDat->fuelTimestamp - pDat->fuelBurnTimestamp ) >= mujoeTimestamp_msToTicks( FUELBURN_SAMPLE_PERIOD ) )
+    {
+      pDat->fuelBurnTimestamp = pDat->fuelTimestamp;
+      if( mujoeFuelBurn_update( pDat->fuelLvlFilt ) )
+        sensorMgrTask_SendOSALMsg( mainTask_getTaskId(), SENSORMGR_FUEL_TTE_ALERT );
+      pDat->fuelBurnRate = mujoeFuelBurn_getRate();
+      pDat->fuelTte = mujoeFuelBurn_getTte();
+    }
+  }
+  
+} // MSPFG_dataRdyIntHdlr
+
+// Compares the unfiltered level "lvl" (0.01 %) with the critical threshold and
+// raises the alarm event on the mainTask on each change. Done before the slosh
+// filter so the alarm is not held back by it.
+// The gauge is programmed with the threshold and does its own compare, see
+// MSPFG_programCritThresh, but it flags a crossing on MSP_INT, the line it also
+// pulses for every measurement, and has no status bit telling the two apart.
+// This compare only stands in for that missing bit: with a tank table the level
+// is table derived and checked against fuelCritThresh, otherwise it is the
+// gauge's linear level and checked against the threshold read back from the
+// gauge in the same snapshot.
+static void MSPFG_checkCritLevel( int16 lvl )
+{
+  ppgfgSensorData_t *pDat = &brdSensorDat.ppgfg;
+  bool crit = pDat->fuelCrit;
+  
+  uint8 thresh = mujoeTankLut_isValid() ? pDat->fuelCritThresh : pDat->fuelSnap.fuelLvlCritThresh;
+  int16 critLvl = (int16)thresh * 100;
+  
+  if( !crit && ( lvl <= critLvl ) )
+    crit = TRUE;
+  else if( crit && ( lvl > critLvl + SENSORMGR_FUEL_CRIT_HYST * 100 ) )
+    crit = FALSE;
+  
+  if( crit != pDat->fuelCrit )
+  {
+    pDat->fuelCrit = crit;
+    osal_set_event( mainTask_getTaskId(), MAIN_FUEL_ALARM_EVT );
+  }
+  
+} // MSPFG_checkCritLevel
+
+// Programs fuelCritThresh into the gauge. The gauge compares its linear level,
+// CAP_ALGO * 100 / CAP_FULL, so with a tank table the threshold is taken to the
+// capacitance at which the table holds that share of the full volume and put
+// back on the gauge's scale, truncated like the gauge's level so its flag comes
+// at most 1 % early. A gauge without CAP_FULL gets the threshold as is.
+static bool MSPFG_programCritThresh( void )
+{
+  uint8 thresh = brdSensorDat.ppgfg.fuelCritThresh;
+  
+  if( mujoeTankLut_isValid() )
+  {
+    mspfgSnapshot_t snap;
+    if( !mspfg_readSnapshot( &snap ) )
+      return FALSE;
+    if( snap.capFull != 0 )
+    {
+      uint16 vol = (uint16)( ( (uint32)mujoeTankLut_getFullVolume() * thresh ) / 100 );
+      uint32 lvl = ( (uint32)mujoeTankLut_volumeToCap( vol ) * 100 ) / snap.capFull;
+      thresh = ( lvl > MSPFG_FUEL_LVL_MAX ) ? MSPFG_FUEL_LVL_MAX : (uint8)lvl;
+    }
+  }
+  
+  return mspfg_setFuelLvlCritThresh( thresh );
+  
+} // MSPFG_programCritThresh
+
+// Every SENSORMGR_RPM_PERIOD ms the accelerometer is switched to its vibration
+// profile until a block is captured. The block is then run through the
+// Goertzel bank one bin per event so other events are not held off.
+static void sensorMgrTask_rpmEstimator( void )
+{
+  if( mujoeRpm_isBlockReady() )
+  {
+    if( mujoeRpm_process() )
+    {
+      brdSensorDat.ppgfg.engRpm = mujoeRpm_getRpm();
+      osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT, SENSORMGR_RPM_PERIOD );
+    }
+    else
+      osal_set_event( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT );
+  }
+  // Capture timed out, drop it and try again next period
+  else if( mujoeRpm_isCapturing() )
+  {
+    mujoeRpm_abortCapture();
+    VOID MMA8453QMgr_setHighRate( FALSE );
+    osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT, SENSORMGR_RPM_PERIOD );
+  }
+  // Engine cannot be running while stationary, and the profile may not want
+  // the capture, skip it
+  else if( MMA8453QMgr_isSleeping() || !sensorRpmEnabled )
+  {
+    brdSensorDat.ppgfg.engRpm = 0;
+    osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT, SENSORMGR_RPM_PERIOD );
+  }
+  else
+  {
+    if( mujoeRpm_startCapture() && MMA8453QMgr_setHighRate( TRUE ) )
+      osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT, SENSORMGR_RPM_CAPTURE_TIMEOUT );
+    else
+    {
+      mujoeRpm_abortCapture();
+      osal_start_timerEx( sensorMgrTask_TaskID, SENSORMGR_RPM_EVT, SENSORMGR_RPM_PERIOD );
+    }
+  }
+  
+} // sensorMgrTask_rpmEstimator
+
+// Feeds the flight state detector: flying while the engine runs or the
+// airframe climbs or sinks, moved on an accel transient or while the accel is
+// busy. A change of target is passed to the mainTask, which applies it.
+static void sensorMgrTask_opProfileDetect( void )
+{
+  int16 vario = mujoeVario_getVerticalSpeed();
+  bool running = ( ( brdSensorDat.ppgfg.engRpm > 0 ) ||
+                   ( vario > SENSORMGR_OPPROFILE_FLIGHT_VARIO ) ||
+                   ( vario < -SENSORMGR_OPPROFILE_FLIGHT_VARIO ) ) ? TRUE : FALSE;
+  bool moving = ( sensorMotionSeen ||
+                  ( MMA8453QMgr_getActivity() > SENSORMGR_OPPROFILE_MOVING_ACTIVITY ) ) ? TRUE : FALSE;
+  sensorMotionSeen = FALSE;
+  
+  if( mujoeOpProfile_detect( running, moving, SENSORMGR_OPPROFILE_PERIOD ) )
+    sensorMgrTask_SendOSALMsg( mainTask_getTaskId(), SENSORMGR_OPPROFILE_CHANGE );
+  
+} // sensorMgrTask_opProfileDetect
+
+static bool sensorMgrTask_initSensors( void )
+{
+  // Init EEPROM IC first, it holds cached calibration data for the other ICs
   if( !CAT24C512_initHardware() )
     return FALSE;
+  sensorMgrTask_initFuelTilt();
+  sensorMgrTask_initTankLut();
+  mujoeBlackBox_init();
+  
+  // Registered sensors, in registration order. One that fails starts offline
+  // and is probed by the health monitor rather than stopping the board.
+  for( uint8 i = 0; i < sensorSchedNum; i++ )
+  {
+    if( ( sensorSchedTbl[i].pDesc->init != NULL ) && !sensorSchedTbl[i].pDesc->init() )
+    {
+      sensorSchedTbl[i].offline = TRUE;
+      sensorSchedTbl[i].reinitCnt = SENSORMGR_HEALTH_MAX_REINITS;
+    }
+  }
   
   // BEGIN TEST
   sensorMgrTask_SendOSALMsg( mainTask_getTaskId(), SENSORMGR_HWINIT_DONE );     // TEST
@@ -269,6 +1140,134 @@ static bool sensorMgrTask_initSensors( void )
   
 } // sensorMgrTask_initSensors
 
+// Loads the barometer PROM from the EEPROM cache when it still matches the fitted
+// IC (one PROM word read). Otherwise reads and validates the full PROM and
+// refreshes the cache.
+static bool sensorMgrTask_initBarometer( void )
+{
+  uint16 prom[MS560702_PROM_NUM_WORDS];
+  
+  if( CAT24C512_readRecord( EEPROM_PAGE_MS5_PROM_CACHE, MS560702_getI2CAddr(), 
+                            (uint8 *)prom, sizeof( prom ) ) &&
+      MS560702_loadPROM( prom ) )
+    return TRUE;
+  
+  if( !MS560702_initHardware() )
+    return FALSE;
+  
+  // Failing to refresh the cache only costs a full PROM read on the next boot
+  MS560702_getPROM( prom );
+  VOID CAT24C512_writeRecord( EEPROM_PAGE_MS5_PROM_CACHE, MS560702_getI2CAddr(), 
+                              (uint8 *)prom, sizeof( prom ) );
+  
+  return TRUE;
+  
+} // sensorMgrTask_initBarometer
+
+// Restores the offset calibration from EEPROM so it is programmed with the rest
+// of the configuration
+static bool sensorMgrTask_initAccelerometer( void )
+{
+  int8 offset[MMA_NUM_AXES];
+  
+  if( CAT24C512_readRecord( EEPROM_PAGE_ACCEL_OFFSETS, MMAMGR_OFFSET_RECORD_KEY, 
+                            (uint8 *)offset, sizeof( offset ) ) )
+    MMA8453QMgr_setOffsets( offset );
+  
+  return MMA8453QMgr_initHardware();
+  
+} // sensorMgrTask_initAccelerometer
+
+static bool MMA8453_init( void )
+{
+  bool wasSleeping = MMA8453QMgr_isSleeping();
+  uint8 wasEnabled = sensorMgrTask_schedEnabledMask();
+  
+  // Re-applying the profile wakes the part, resume what its sleep suspended
+  if( !sensorMgrTask_initAccelerometer() )
+    return FALSE;
+  if( wasSleeping && !MMA8453QMgr_isSleeping() )
+    sensorMgrTask_schedPower( wasEnabled );
+  if( !muJoeGPIO_registerIntCallback( PINID_ACCEL_INT1, MMA8453_drdyIntHdlr ) )
+    return FALSE;
+  enableP1PinInterrupt( 0x01 << gpioPinTable[PINID_ACCEL_INT1].pin );
+  if( !muJoeGPIO_registerIntCallback( PINID_ACCEL_INT2, MMA8453_motionIntHdlr ) )
+    return FALSE;
+  enableP0PinInterrupt( 0x01 << gpioPinTable[PINID_ACCEL_INT2].pin );
+  
+  return TRUE;
+  
+} // MMA8453_init
+
+// Fuel gauge streams measurements flagged on MSP_INT. Returns FALSE if the gauge
+// does not acknowledge, the health monitor then keeps it offline and probing.
+// The timeout for its first measurement runs from here.
+static bool MSPFG_init( void )
+{
+  if( !muJoeGPIO_registerIntCallback( PINID_MSP_INT, MSPFG_dataRdyIntHdlr ) )
+    return FALSE;
+  enableP0PinInterrupt( 0x01 << gpioPinTable[PINID_MSP_INT].pin );
+  mspfgMeasured = FALSE;
+  brdSensorDat.ppgfg.fuelTimestamp = mujoeTimestamp_now();
+  
+  if( !MSPFG_programCritThresh() )
+    return FALSE;
+  return mspfg_sendCommand( MSPFG_CMD_ST_CONT_DATA );
+  
+} // MSPFG_init
+
+// Parked by the operating profile or while stationary, MSPFG_init restarts
+// continuous mode and re-enables MSP_INT
+static void MSPFG_suspend( void )
+{
+  disableP0PinInterrupt( 0x01 << gpioPinTable[PINID_MSP_INT].pin );
+  VOID mspfg_sendCommand( MSPFG_CMD_SLEEP );
+  
+} // MSPFG_suspend
+
+// Programs the offsets from the completed calibration, persists them and
+// reports the outcome
+static void sensorMgrTask_finishAccelCal( void )
+{
+  int8 offset[MMA_NUM_AXES];
+  bool done = MMA8453QMgr_applyOffsetCal();
+  
+  if( done )
+  {
+    MMA8453QMgr_getOffsets( offset );
+    done = CAT24C512_writeRecord( EEPROM_PAGE_ACCEL_OFFSETS, MMAMGR_OFFSET_RECORD_KEY, 
+                                  (uint8 *)offset, sizeof( offset ) );
+  }
+  
+  sensorMgrTask_SendOSALMsg( mainTask_getTaskId(), done ? SENSORMGR_ACCEL_CAL_DONE : SENSORMGR_ACCEL_CAL_FAIL );
+  
+} // sensorMgrTask_finishAccelCal
+
+// Loads the tank capacitance to volume table, the gauge's linear mapping is
+// used if none is stored
+static void sensorMgrTask_initTankLut( void )
+{
+  mujoeTankLutTbl_t tbl;
+  
+  if( CAT24C512_readRecord( EEPROM_PAGE_TANK_LUT, TANKLUT_RECORD_KEY, 
+                            (uint8 *)&tbl, sizeof( mujoeTankLutTbl_t ) ) )
+    VOID mujoeTankLut_load( &tbl );
+  
+} // sensorMgrTask_initTankLut
+
+// Loads the fuel tilt correction coefficients, no correction if none are stored
+static void sensorMgrTask_initFuelTilt( void )
+{
+  mujoeFuelTiltCoeff_t coeff;
+  
+  if( CAT24C512_readRecord( EEPROM_PAGE_FUEL_TILT_COEFF, FUELTILT_RECORD_KEY, 
+                            (uint8 *)&coeff, sizeof( mujoeFuelTiltCoeff_t ) ) )
+    mujoeFuelTilt_init( &coeff );
+  else
+    mujoeFuelTilt_init( NULL );
+  
+} // sensorMgrTask_initFuelTilt
+
 static bool sensorMgrTask_SendOSALMsg( uint8 destTaskID, sensorMgrTask_msg_t msg )
 {
   taskMsgrMsg_t taskMsg;
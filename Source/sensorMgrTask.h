@@ -18,6 +18,7 @@ extern "C"
 #include "bcomdef.h"
 #include "OSAL.h"
 #include "OSAL_PwrMgr.h"
+#include "OSAL_Timers.h"
 
 #include "gatt.h"
 #include "hci.h"
@@ -30,6 +31,21 @@ extern "C"
 #include "CAT24C512.h"
 #include "MMA8453Q.h"
 #include "MSPFuelGauge.h"
+#include "MS560702Mgr.h"
+#include "MMA8453QMgr.h"
+
+// Sensor Fusion
+#include "mujoeVario.h"
+#include "mujoeRpm.h"
+#include "mujoeFuelTilt.h"
+#include "mujoeFuelEst.h"
+#include "mujoeFuelBurn.h"
+#include "mujoeTankLut.h"
+#include "mujoeBlackBox.h"
+#include "mujoeFuelCap.h"
+#include "mujoeSampleRing.h"
+#include "mujoeOpProfile.h"
+#include "mujoeTimestamp.h"
   
 ////////////////////////////////////////////////////////////////////////////////
 // DEFINES
@@ -38,18 +54,136 @@ extern "C"
 // Sensor Manager Task Events
 #define SENSORMGR_INIT_SENSORS_EVT                              0x0001
 #define SENSORMGR_DATA_COLLECTOR_EVT                            0x0002
+#define SENSORMGR_RPM_EVT                                       0x0004
+#define SENSORMGR_ACCEL_CAL_EVT                                 0x0008
+#define SENSORMGR_BBOX_EVT                                      0x0010
+#define SENSORMGR_OPPROFILE_EVT                                 0x0020
   
-// Max number of onboard sensors
-#define SENSORMGR_MAX_NUM_SENSORS                               2
+// Engine RPM estimation: capture interval and capture timeout (ms)
+#define SENSORMGR_RPM_PERIOD                                    2000
+#define SENSORMGR_RPM_CAPTURE_TIMEOUT                           1000
+  
+// Max number of registered sensors, room is left for sensors added by the airframe build.
+// The health word has bits for 8 slots.
+#define SENSORMGR_MAX_NUM_SENSORS                               6
+
+// Returned by sensorMgrTask_registerSensor when the registry is full
+#define SENSORMGR_SENSOR_NONE                                   0xFF
+
+// Nominal sensor periods (ms). The barometer and accelerometer follow their
+// managers' sample periods from then on.
+#define SENSORMGR_BARO_PERIOD                                   MS5MGR_PERIOD_ACTIVE
+#define SENSORMGR_ACCEL_PERIOD                                  MMAMGR_DRAIN_PERIOD
+#define SENSORMGR_FUEL_PERIOD                                   500
+
+// Sensors whose class the operating profile does not schedule are parked,
+// the collector only looks at them this often (ms)
+#define SENSORMGR_PARKED_PERIOD                                 60000
+
+// Flight state detector period (ms). Vertical speed (cm/s) beyond which the
+// airframe counts as flying, and accel activity above which it counts as moved.
+#define SENSORMGR_OPPROFILE_PERIOD                              1000
+#define SENSORMGR_OPPROFILE_FLIGHT_VARIO                        200
+#define SENSORMGR_OPPROFILE_MOVING_ACTIVITY                     64
+
+// Fuel gauge counts as failed if no measurement arrives for this long (ms)
+#define SENSORMGR_FUEL_TIMEOUT                                  5000
+
+// Barometer readings outside the MS5607 operating range (Pa) are rejected
+#define SENSORMGR_BARO_MIN_PRES                                 1000
+#define SENSORMGR_BARO_MAX_PRES                                 120000
+
+// Identical raw pressure codes in a row before the barometer counts as stuck
+#define SENSORMGR_BARO_STUCK_LIMIT                              20
+
+// Sensor health escalation: a failed job is retried on the next period. After
+// SENSORMGR_HEALTH_REINIT_FAILS failures in a row the driver is re-initialized,
+// after SENSORMGR_HEALTH_MAX_REINITS re-inits without a good sample the sensor
+// is taken offline and probed with a re-init every SENSORMGR_HEALTH_PROBE_PERIOD ms.
+#define SENSORMGR_HEALTH_REINIT_FAILS                           3
+#define SENSORMGR_HEALTH_MAX_REINITS                            3
+#define SENSORMGR_HEALTH_PROBE_PERIOD                           10000
+
+// Conversion retries within a job before the job counts as failed
+#define SENSORMGR_HEALTH_MAX_RETRIES                            4
+
+// Health bits of a sensor slot, see sensorMgrTask_getHealth
+#define SENSORMGR_HEALTH_FAULT( slot )                          ( 0x0001 << ( slot ) )  // Failing, not yet recovered
+#define SENSORMGR_HEALTH_OFFLINE( slot )                        ( 0x0100 << ( slot ) )  // Taken offline
+
+// Default critical fuel level threshold, and the
+// margin the level must recover by before the alarm clears (%)
+#define SENSORMGR_FUEL_CRIT_THRESH                              15
+#define SENSORMGR_FUEL_CRIT_HYST                                2
 
 ////////////////////////////////////////////////////////////////////////////////
 // TYPEDEFS
 ////////////////////////////////////////////////////////////////////////////////
 
+// Outcome of a sensor fetch
+typedef enum
+{
+  SENSOR_FETCH_DONE = 0,        // Job complete
+  SENSOR_FETCH_CONVERT,         // Start the job's next conversion
+  SENSOR_FETCH_RETRY,           // Result not ready, fetch again after the conversion latency
+  SENSOR_FETCH_FAIL,            // Bus error, no data or reading out of range, sample discarded
+  SENSOR_FETCH_PENDING,         // No data yet but not overdue, job closed without a health verdict
+  
+}sensorFetch_t;
+
+// When a sensor is scheduled. The operating profile further picks which
+// classes run at all, see OPPROFILE_SENSORS_*.
+typedef enum
+{
+  SENSOR_PWR_ALWAYS = 0,        // Every period
+  SENSOR_PWR_MOTION,            // Suspended while the airframe is stationary (accel auto-sleep)
+  
+}sensorPwrClass_t;
+
+// Everything the scheduler needs to run a sensor. A job is one or more
+// conversions, each started with startConv and collected with fetch once
+// convTime has passed. "step" counts the conversions within the job. Sensors
+// without fields of their own in ppgfgSensorData_t publish through getOutput,
+// whose value lands in the SRING_CH_AUX sample ring channel tagged with the slot.
+typedef struct sensorDesc_def
+{
+  bool                  (*init)( void );                // Hardware init, also used to recover the sensor. NULL if none
+  void                  (*suspend)( void );             // Lowest power state while not scheduled, init resumes. NULL if none
+  bool                  (*startConv)( uint8 step );     // NULL if the sensor has nothing to trigger
+  sensorFetch_t         (*fetch)( uint8 step );
+  uint8                 (*convTime)( void );            // Conversion latency (ms), NULL if none
+  uint16                (*getPeriod)( void );           // Current period (ms), NULL to keep the nominal one
+  uint32                (*getSig)( void );              // Raw value of the last sample, NULL to skip stuck detection
+  int32                 (*getOutput)( void );           // Value of the completed job for SRING_CH_AUX, NULL if none
+  uint8                 stuckLimit;                     // Identical getSig values in a row that count as stuck
+  uint16                period;                         // Nominal period (ms)
+  sensorPwrClass_t      pwrClass;
+  
+}sensorDesc_t;
+
 typedef struct ppgfgSensorData_def
 {
   uint32                barPresCode;
   uint32                barTempCode;
+  int32                 barPressure;            // Compensated pressure (Pa)
+  int32                 barTemperature;         // Compensated temperature (0.01 degC)
+  uint32                barTimestamp;           // Sleep timer timestamp at pressure conversion completion
+  int16                 accXYZ[MMA_NUM_AXES];   // Accel sample averaged over the drain period (10-bit counts)
+  uint8                 accStatus;              // Accel STATUS register at last DRDY read
+  uint32                accTimestamp;           // Sleep timer timestamp at the newest drained DRDY
+  uint16                engRpm;                 // Engine speed from airframe vibration (RPM), 0 if not running
+  mspfgSnapshot_t       fuelSnap;               // Fuel gauge capacitances and level (%) as last read
+  uint16                fuelVol;                // Fuel volume from the tank table (mL), 0 without a table
+  int16                 fuelLvl;                // Tilt corrected fuel level (0.01 %)
+  int16                 fuelLvlFilt;            // Slosh filtered fuel level (0.01 %)
+  uint8                 fuelConf;               // Confidence in fuelLvlFilt (%)
+  int16                 fuelBurnRate;           // Burn rate (0.01 %/h), positive while burning
+  uint16                fuelTte;                // Predicted time to empty (min), FUELBURN_TTE_UNKNOWN if not burning
+  uint32                fuelBurnTimestamp;      // Sleep timer timestamp at last burn regression point
+  uint32                fuelTimestamp;          // Sleep timer timestamp at fuel gauge measurement ready
+  bool                  fuelCrit;               // TRUE while the fuel level is at or below the critical threshold
+  uint8                 fuelCritThresh;         // Critical fuel level threshold (%)
+  uint16                sweepPeriod;            // Time (ms) the collector took to clear its last burst of due work
   
 }ppgfgSensorData_t;
 
@@ -59,11 +193,32 @@ typedef union boardSensorData_def
   
 } boardSensorData_t;
 
+////////////////////////////////////////////////////////////////////////////////
+// EXTERN VARS
+////////////////////////////////////////////////////////////////////////////////
+
+extern boardSensorData_t        brdSensorDat;
+
 ////////////////////////////////////////////////////////////////////////////////
 // API FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
 
 uint8 sensorMgrTask_getTaskId( void );
+uint8 sensorMgrTask_registerSensor( const sensorDesc_t *pDesc );
+uint16 sensorMgrTask_getHealth( void );
+bool sensorMgrTask_setFuelTiltCoeff( mujoeFuelTiltCoeff_t *pCoeff );
+bool sensorMgrTask_setFuelTiltLevelRef( void );
+void sensorMgrTask_startAccelCal( void );
+bool sensorMgrTask_clearBlackBox( void );
+bool sensorMgrTask_setFuelTteThresholds( uint16 *pThresh );
+void sensorMgrTask_startTankCal( void );
+bool sensorMgrTask_addTankCalPoint( uint16 vol );
+bool sensorMgrTask_finishTankCal( void );
+bool sensorMgrTask_setFuelCritThresh( uint8 thresh );
+bool sensorMgrTask_startFuelCapture( void );
+void sensorMgrTask_stopFuelCapture( void );
+bool sensorMgrTask_selectOpProfile( uint8 sel );
+void sensorMgrTask_applyOpProfile( const mujoeOpProfileCfg_t *pCfg );
 /*
  * Task Initialization for the BLE Application
  */
@@ -0,0 +1,695 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hostTest.c
+// @author: Joseph Corteo Jr.
+//
+// Host checks of the platform independent kernels: barometer compensation,
+// altitude table and variometer, RPM estimator, fuel slosh filter, burn
+// regression, tank table, sleep timer timestamps and the sample ring, and of
+// the fuel gauge driver against a register model of the gauge, including how
+// soon the gauge's level tracks a drain across the critical threshold. Built
+// with a desktop compiler against the stand-ins in stub/, see the Makefile.
+// The alarm's edge to notification time is measured by simTest.
+// Also reports the time each kernel takes per call on the host.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "MS560702.h"
+#include "MSPFuelGauge.h"
+#include "CAT24C512.h"
+#include "mujoeVario.h"
+#include "mujoeRpm.h"
+#include "mujoeFuelEst.h"
+#include "mujoeFuelBurn.h"
+#include "mujoeTankLut.h"
+#include "mujoeTimestamp.h"
+#include "mujoeSampleRing.h"
+
+#include "testMspfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+#define CHECK( cond, ... )                                                      \
+  do {                                                                          \
+    testNum++;                                                                  \
+    if( !( cond ) )                                                             \
+    {                                                                           \
+      testFail++;                                                               \
+      printf( "FAIL %s:%d: ", __func__, __LINE__ );                             \
+      printf( __VA_ARGS__ );                                                    \
+      printf( "\n" );                                                           \
+    }                                                                           \
+  } while( 0 )
+
+#ifndef M_PI
+#define M_PI                            3.14159265358979323846
+#endif
+
+// Accelerometer input rate of the RPM capture (Hz)
+#define TEST_RPM_INPUT_RATE             ( RPM_SAMPLE_RATE * RPM_DECIMATION )
+
+// RPM tolerance: the parabolic fit on bin power is biased by up to 0.3 bin
+// (56 RPM) between bins
+#define TEST_RPM_TOL                    66
+
+// Critical fuel simulation: gauge measurement period (ms, SENSORMGR_FUEL_PERIOD),
+// alarm threshold (%), drain rate (0.01 %/s) and accel activity in flight
+#define TEST_CRIT_PERIOD                500
+#define TEST_CRIT_THRESH                15
+#define TEST_CRIT_DRAIN                 50
+#define TEST_CRIT_ACTIVITY              1024
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static int                      testNum = 0;
+static int                      testFail = 0;
+
+// Sleep timer registers read by mujoeTimestamp
+volatile uint8                  ST0, ST1, ST2;
+
+// Word the barometer stub answers PROM reads with
+static uint16                   testPromReadWord;
+
+// MS5607 datasheet example coefficients, C1 thru C6
+static uint16                   testProm[MS560702_PROM_NUM_WORDS] =
+{
+  0x0000, 46372, 43981, 29059, 27842, 31553, 28165, 0x0000,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// BUS AND HEAP STUBS
+////////////////////////////////////////////////////////////////////////////////
+
+void *osal_mem_alloc( uint16 size )
+{
+  return malloc( size );
+
+} // osal_mem_alloc
+
+void osal_mem_free( void *ptr )
+{
+  free( ptr );
+
+} // osal_mem_free
+
+uint8 mujoeI2C_write( uint8 addr, uint8 len, uint8 *pBuf, uint8 stp )
+{
+  (void)stp;
+  if( addr == MSPFG_DEFAULT_I2C_ADDR )
+    return testMspfgWrite( len, pBuf );
+
+  return len;
+
+} // mujoeI2C_write
+
+uint8 mujoeI2C_read( uint8 addr, uint8 len, uint8 *pBuf )
+{
+  if( addr == MSPFG_DEFAULT_I2C_ADDR )
+    return testMspfgRead( len, pBuf );
+
+  if( len != 2 )
+    return 0;
+
+  pBuf[0] = (uint8)( testPromReadWord >> 8 );
+  pBuf[1] = (uint8)testPromReadWord;
+  return len;
+
+} // mujoeI2C_read
+
+bool mujoeI2C_ackPoll( uint8 slaWriteAddr )
+{
+  if( slaWriteAddr == MSPFG_DEFAULT_I2C_ADDR )
+    return testMspfg.present;
+
+  return TRUE;
+
+} // mujoeI2C_ackPoll
+
+bool mujoeI2C_i2cPingSlave( uint8 slaWriteAddr )
+{
+  if( slaWriteAddr == MSPFG_DEFAULT_I2C_ADDR )
+    return testMspfg.present;
+
+  return TRUE;
+
+} // mujoeI2C_i2cPingSlave
+
+////////////////////////////////////////////////////////////////////////////////
+// HELPERS
+////////////////////////////////////////////////////////////////////////////////
+
+// Bit serial CRC4 as given in the MS5607 datasheet
+static uint8 testCrc4( uint16 *prom )
+{
+  uint16 nRem = 0;
+  uint16 crcRead = prom[7];
+
+  prom[7] &= 0xFF00;
+  for( int cnt = 0; cnt < 16; cnt++ )
+  {
+    if( cnt & 1 )
+      nRem ^= prom[cnt >> 1] & 0x00FF;
+    else
+      nRem ^= prom[cnt >> 1] >> 8;
+    for( int bit = 8; bit > 0; bit-- )
+      nRem = ( nRem & 0x8000 ) ? ( nRem << 1 ) ^ 0x3000 : ( nRem << 1 );
+  }
+  prom[7] = crcRead;
+
+  return (uint8)( ( nRem >> 12 ) & 0x000F );
+
+} // testCrc4
+
+// Datasheet first and second order compensation in 64-bit math
+static void testMs5Reference( uint32 d1, uint32 d2, int32 *pP, int32 *pT )
+{
+  int64_t c1 = testProm[1], c2 = testProm[2], c3 = testProm[3];
+  int64_t c4 = testProm[4], c5 = testProm[5], c6 = testProm[6];
+
+  int64_t dT = (int64_t)d2 - c5 * 256;
+  int64_t temp = 2000 + dT * c6 / 8388608;
+  int64_t off = c2 * 131072 + c4 * dT / 64;
+  int64_t sens = c1 * 65536 + c3 * dT / 128;
+
+  if( temp < 2000 )
+  {
+    int64_t t2 = dT * dT / 2147483648LL;
+    int64_t off2 = 61 * ( temp - 2000 ) * ( temp - 2000 ) / 16;
+    int64_t sens2 = 2 * ( temp - 2000 ) * ( temp - 2000 );
+    if( temp < -1500 )
+    {
+      off2 += 15 * ( temp + 1500 ) * ( temp + 1500 );
+      sens2 += 8 * ( temp + 1500 ) * ( temp + 1500 );
+    }
+    temp -= t2;
+    off -= off2;
+    sens -= sens2;
+  }
+
+  *pP = (int32)( ( (int64_t)d1 * sens / 2097152 - off ) / 32768 );
+  *pT = (int32)temp;
+
+} // testMs5Reference
+
+static double testSeconds( void )
+{
+  return (double)clock() / CLOCKS_PER_SEC;
+
+} // testSeconds
+
+static void testSetSleepTimer( uint32 st )
+{
+  ST0 = (uint8)st;
+  ST1 = (uint8)( st >> 8 );
+  ST2 = (uint8)( st >> 16 );
+
+} // testSetSleepTimer
+
+// Feeds one RPM capture block with an X axis tone of "toneHz" sampled at
+// "inputRate" (Hz) and runs the Goertzel bank. Returns the estimate.
+static uint16 testRpmRun( double toneHz, double inputRate, int amp )
+{
+  int16 xyz[RPM_NUM_AXES];
+  uint32 n = 0;
+
+  if( !mujoeRpm_startCapture() )
+    return 0xFFFF;
+
+  while( mujoeRpm_isCapturing() )
+  {
+    double t = n / inputRate;
+    xyz[0] = (int16)lround( amp * sin( 2 * M_PI * toneHz * t ) );
+    xyz[1] = (int16)( ( n * 7 ) % 5 ) - 2;         // Low level broadband residue
+    xyz[2] = 0;
+    VOID mujoeRpm_addSample( xyz, (uint32)( t * TS_TICKS_PER_SEC ) );
+    n++;
+  }
+
+  while( !mujoeRpm_process() );
+  return mujoeRpm_getRpm();
+
+} // testRpmRun
+
+////////////////////////////////////////////////////////////////////////////////
+// TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+static void testMs5Compensation( void )
+{
+  int32 p, t, pRef, tRef;
+
+  VOID MS560702_initDriver( FALSE );
+  testProm[7] = ( testProm[7] & 0xFFF0 ) | ( testCrc4( testProm ) ^ 0x01 );
+  testPromReadWord = testProm[7];
+  CHECK( !MS560702_loadPROM( testProm ), "PROM with a bad CRC accepted" );
+  CHECK( !MS560702_calcCompensated( 6465444, 8077636, &p, &t ), "compensation without PROM" );
+
+  testProm[7] ^= 0x01;
+  testPromReadWord = testProm[7];
+  CHECK( MS560702_loadPROM( testProm ), "PROM with a valid CRC rejected" );
+
+  // Below -40 thru +85 degC across the pressure range, against the 64-bit
+  // reference. mujoeToolBox_mulShr32 truncates its partial products one by
+  // one, so up to 2 LSB (0.02 degC, 2 Pa) of difference is expected.
+  int32 worstP = 0, worstT = 0;
+  for( int32 tc = -4000; tc <= 8500; tc += 250 )
+  {
+    uint32 d2 = (uint32)( testProm[5] * 256L + (int32)( ( (int64_t)( tc - 2000 ) << 23 ) / testProm[6] ) );
+    for( uint32 d1 = 2000000; d1 <= 9000000; d1 += 250000 )
+    {
+      VOID MS560702_calcCompensated( d1, d2, &p, &t );
+      testMs5Reference( d1, d2, &pRef, &tRef );
+      if( labs( p - pRef ) > worstP ){ worstP = labs( p - pRef ); }
+      if( labs( t - tRef ) > worstT ){ worstT = labs( t - tRef ); }
+    }
+  }
+  CHECK( worstP <= 2, "pressure off the reference by %ld Pa", (long)worstP );
+  CHECK( worstT <= 2, "temperature off the reference by %ld", (long)worstT );
+
+  double t0 = testSeconds();
+  for( uint32 i = 0; i < 1000000; i++ )
+    VOID MS560702_calcCompensated( 6465444 + ( i & 0xFFF ), 8077636, &p, &t );
+  printf( "  MS560702_calcCompensated    %6.1f ns/call\n", ( testSeconds() - t0 ) * 1000.0 );
+
+} // testMs5Compensation
+
+static void testVarioAltitude( void )
+{
+  // Sea level and the top of the table, where a 16-bit table offset wraps
+  int32 alt = mujoeVario_pressureToAltitude( 101325 );
+  CHECK( labs( alt ) <= 1000, "101325 Pa -> %ld mm", (long)alt );
+  alt = mujoeVario_pressureToAltitude( 95536 );
+  CHECK( labs( alt - 493436 ) <= 700, "95536 Pa -> %ld mm", (long)alt );
+
+  // Strictly decreasing over the table, within 0.7 m of the ISA curve below
+  // 3000 m and 2.9 m up to the top of the table
+  int32 prev = INT32_MAX;
+  int32 worst = 0, worstLow = 0;
+  for( int32 p = VARIO_ALT_TBL_MIN_PRES; p <= VARIO_ALT_TBL_MAX_PRES; p += 100 )
+  {
+    alt = mujoeVario_pressureToAltitude( p );
+    int32 err = labs( alt - (int32)lround( 44330770.0 * ( 1.0 - pow( p / 101325.0, 0.190263 ) ) ) );
+    if( err > worst ){ worst = err; }
+    if( ( p >= 70000 ) && ( err > worstLow ) ){ worstLow = err; }
+    CHECK( alt < prev, "altitude not decreasing at %ld Pa", (long)p );
+    prev = alt;
+  }
+  CHECK( worstLow <= 700, "table off the ISA curve by %ld mm below 3000 m", (long)worstLow );
+  CHECK( worst <= 2900, "table off the ISA curve by %ld mm", (long)worst );
+
+} // testVarioAltitude
+
+static void testVarioFusion( void )
+{
+  // Baro only: steady 2 m/s climb sampled at 20 Hz
+  mujoeVario_init();
+  for( int i = 0; i <= 600; i++ )
+    mujoeVario_baroUpdate( 2000L * i / 20, 50 );
+  int16 vs = mujoeVario_getVerticalSpeed();
+  CHECK( abs( vs - 200 ) <= 10, "baro only climb %d cm/s", vs );
+
+  // Accel aided: accel reads 0 (steady climb), baro at 20 Hz, accel at 100 Hz
+  mujoeVario_init();
+  for( int i = 0; i <= 3000; i++ )
+  {
+    mujoeVario_accelUpdate( 0, 10 );
+    if( ( i % 5 ) == 0 )
+      mujoeVario_baroUpdate( 2000L * i / 100, 50 );
+  }
+  vs = mujoeVario_getVerticalSpeed();
+  CHECK( abs( vs - 200 ) <= 10, "accel aided climb %d cm/s", vs );
+  CHECK( labs( mujoeVario_getAltitude() - 60000 ) < 1000, "accel aided altitude %ld mm",
+         (long)mujoeVario_getAltitude() );
+
+  // Level flight after a 1 m/s^2 step: speed follows the accel at once
+  mujoeVario_init();
+  mujoeVario_baroUpdate( 0, 50 );
+  for( int i = 0; i < 50; i++ )
+    mujoeVario_accelUpdate( 1000, 10 );
+  vs = mujoeVario_getVerticalSpeed();
+  CHECK( ( vs > 30 ) && ( vs <= 50 ), "0.5 s of 1 m/s^2 -> %d cm/s", vs );
+
+  double t0 = testSeconds();
+  for( uint32 i = 0; i < 1000000; i++ )
+    mujoeVario_accelUpdate( (int32)( i & 0xFF ), 10 );
+  printf( "  mujoeVario_accelUpdate      %6.1f ns/call\n", ( testSeconds() - t0 ) * 1000.0 );
+
+} // testVarioFusion
+
+static void testRpm( void )
+{
+  // 100 Hz engine tone at the nominal rate -> 6000 RPM
+  uint16 rpm = testRpmRun( 100.0, TEST_RPM_INPUT_RATE, 40 );
+  CHECK( abs( rpm - 6000 ) <= TEST_RPM_TOL, "100 Hz tone -> %u RPM", rpm );
+
+  // Off bin tones across the band, clear of its edge bins
+  for( double hz = 35.0; hz <= 145.0; hz += 0.7 )
+  {
+    rpm = testRpmRun( hz, TEST_RPM_INPUT_RATE, 40 );
+    CHECK( fabs( rpm - hz * 60 ) <= TEST_RPM_TOL, "%.1f Hz tone -> %u RPM", hz, rpm );
+  }
+
+  // Accelerometer running 6 % slow: the stamps give the real rate, the nominal
+  // rate would read 6 % high
+  rpm = testRpmRun( 100.0, TEST_RPM_INPUT_RATE * 0.94, 40 );
+  CHECK( abs( rpm - 6000 ) <= TEST_RPM_TOL, "100 Hz tone, slow ODR -> %u RPM", rpm );
+
+  // Engine off: broadband residue only
+  rpm = testRpmRun( 100.0, TEST_RPM_INPUT_RATE, 0 );
+  CHECK( rpm == 0, "no tone -> %u RPM", rpm );
+
+  double t0 = testSeconds();
+  for( int i = 0; i < 1000; i++ )
+    VOID testRpmRun( 100.0, TEST_RPM_INPUT_RATE, 40 );
+  printf( "  RPM block (capture + bank)  %6.1f us/block\n", ( testSeconds() - t0 ) * 1000.0 );
+
+} // testRpm
+
+static void testFuelEst( void )
+{
+  mujoeFuelEst_init();
+  for( int i = 0; i < 200; i++ )
+    mujoeFuelEst_update( 5000, 0 );
+  CHECK( mujoeFuelEst_getLevel() == 5000, "steady level %d", mujoeFuelEst_getLevel() );
+  CHECK( mujoeFuelEst_getConfidence() >= 90, "steady confidence %u", mujoeFuelEst_getConfidence() );
+
+  // A lone slosh spike is dropped by the median
+  mujoeFuelEst_update( 9000, 0 );
+  mujoeFuelEst_update( 5000, 0 );
+  CHECK( mujoeFuelEst_getLevel() == 5000, "spike leaked, level %d", mujoeFuelEst_getLevel() );
+
+  // Heavy shaking: noisy samples, lower confidence, level still near the mean
+  uint32 seed = 1;
+  for( int i = 0; i < 400; i++ )
+  {
+    seed = seed * 1103515245 + 12345;
+    mujoeFuelEst_update( 5000 + (int16)( ( seed >> 16 ) % 801 ) - 400, 4096 );
+  }
+  CHECK( abs( mujoeFuelEst_getLevel() - 5000 ) <= 150, "shaken level %d", mujoeFuelEst_getLevel() );
+  CHECK( mujoeFuelEst_getConfidence() < 60, "shaken confidence %u", mujoeFuelEst_getConfidence() );
+
+} // testFuelEst
+
+static void testFuelBurn( void )
+{
+  uint16 thresh[FUELBURN_NUM_THRESH] = FUELBURN_DEFAULT_THRESH;
+  CHECK( mujoeFuelBurn_setThresholds( thresh ), "default thresholds rejected" );
+
+  // 18 %/h from 50 %, one point per FUELBURN_SAMPLE_PERIOD
+  mujoeFuelBurn_init();
+  int16 lvl = 5000;
+  bool alert = FALSE;
+  for( int i = 0; i < FUELBURN_WINDOW_LEN * 2; i++ )
+  {
+    alert |= mujoeFuelBurn_update( lvl );
+    lvl -= 1800 / ( 3600000L / FUELBURN_SAMPLE_PERIOD );
+  }
+  CHECK( abs( mujoeFuelBurn_getRate() - 1800 ) <= 2, "burn rate %d", mujoeFuelBurn_getRate() );
+  uint16 tte = mujoeFuelBurn_getTte();
+  CHECK( abs( (int)tte - ( lvl + 5 ) * 60 / 1800 ) <= 1, "time to empty %u min", tte );
+  CHECK( !alert && ( mujoeFuelBurn_getAlertLvl() == 0 ), "alert raised at %u min", tte );
+
+  // Keep burning down into the alert thresholds
+  uint8 crossings = 0;
+  while( lvl > 0 )
+  {
+    if( mujoeFuelBurn_update( lvl ) )
+      crossings++;
+    lvl -= 5;
+  }
+  CHECK( mujoeFuelBurn_getAlertLvl() == FUELBURN_NUM_THRESH, "alert level %u", mujoeFuelBurn_getAlertLvl() );
+  CHECK( crossings == FUELBURN_NUM_THRESH, "%u threshold crossings", crossings );
+
+  // Not burning: no rate, unknown time to empty
+  mujoeFuelBurn_init();
+  for( int i = 0; i < FUELBURN_WINDOW_LEN; i++ )
+    VOID mujoeFuelBurn_update( 4000 );
+  CHECK( mujoeFuelBurn_getRate() == 0, "idle rate %d", mujoeFuelBurn_getRate() );
+  CHECK( mujoeFuelBurn_getTte() == FUELBURN_TTE_UNKNOWN, "idle time to empty %u", mujoeFuelBurn_getTte() );
+
+} // testFuelBurn
+
+static void testTankLut( void )
+{
+  CHECK( !mujoeTankLut_isValid(), "table valid before load" );
+  CHECK( mujoeTankLut_capToVolume( 1000 ) == 0, "volume without a table" );
+
+  // Irregular tank: narrow sump, wide body. Points out of order, one redone.
+  mujoeTankLut_startCal();
+  CHECK( mujoeTankLut_addCalPoint( 3000, 6000 ), "add point" );
+  CHECK( mujoeTankLut_addCalPoint( 1000, 0 ), "add point" );
+  CHECK( mujoeTankLut_addCalPoint( 2200, 1000 ), "add point" );
+  CHECK( mujoeTankLut_addCalPoint( 2000, 1000 ), "redo point" );
+  CHECK( mujoeTankLut_addCalPoint( 5000, 12000 ), "add point" );
+  CHECK( mujoeTankLut_finishCal() != NULL, "valid table rejected" );
+  CHECK( mujoeTankLut_isValid(), "table not active" );
+
+  CHECK( mujoeTankLut_getFullVolume() == 12000, "full volume %u", mujoeTankLut_getFullVolume() );
+  CHECK( mujoeTankLut_capToVolume( 500 ) == 0, "below table %u", mujoeTankLut_capToVolume( 500 ) );
+  CHECK( mujoeTankLut_capToVolume( 1500 ) == 500, "sump %u", mujoeTankLut_capToVolume( 1500 ) );
+  CHECK( mujoeTankLut_capToVolume( 2000 ) == 1000, "on a point %u", mujoeTankLut_capToVolume( 2000 ) );
+  CHECK( mujoeTankLut_capToVolume( 4000 ) == 9000, "body %u", mujoeTankLut_capToVolume( 4000 ) );
+  CHECK( mujoeTankLut_capToVolume( 9000 ) == 12000, "above table %u", mujoeTankLut_capToVolume( 9000 ) );
+
+  // And back, as used for the gauge's critical threshold
+  CHECK( mujoeTankLut_volumeToCap( 500 ) == 1500, "sump cap %u", mujoeTankLut_volumeToCap( 500 ) );
+  CHECK( mujoeTankLut_volumeToCap( 1000 ) == 2000, "cap on a point %u", mujoeTankLut_volumeToCap( 1000 ) );
+  CHECK( mujoeTankLut_volumeToCap( 9000 ) == 4000, "body cap %u", mujoeTankLut_volumeToCap( 9000 ) );
+  CHECK( mujoeTankLut_volumeToCap( 20000 ) == 5000, "cap above table %u", mujoeTankLut_volumeToCap( 20000 ) );
+
+  // Volume falling with capacitance is refused, the active table stays
+  mujoeTankLut_startCal();
+  VOID mujoeTankLut_addCalPoint( 1000, 5000 );
+  VOID mujoeTankLut_addCalPoint( 2000, 4000 );
+  CHECK( mujoeTankLut_finishCal() == NULL, "decreasing table accepted" );
+  CHECK( mujoeTankLut_getFullVolume() == 12000, "active table replaced" );
+
+  // A full table must fit one EEPROM record
+  CHECK( 1 + TANKLUT_MAX_POINTS * sizeof( mujoeTankLutPoint_t ) <= CAT24C512_RECORD_MAX_DATA_LEN, "table exceeds a record" );
+
+} // testTankLut
+
+static void testMspfgDriver( void )
+{
+  mspfgSnapshot_t snap;
+  uint8 val = 0;
+  uint16 capAlgo, capRaw;
+
+  testMspfgReset();
+  CHECK( mspfg_readReg( MSPFG_WHO_AM_I, &val ) && ( val == TEST_MSPFG_WHO_AM_I ), "who am i 0x%02X", val );
+
+  // Configuration and thresholds land in their registers
+  CHECK( mspfg_writeConfig( 0x03 ) && ( testMspfg.reg[MSPFG_CFG] == 0x03 ), "config" );
+  CHECK( mspfg_setCapFull( 0x1234 ), "cap full write" );
+  CHECK( ( testMspfg.reg[MSPFG_CAP_FULL_LSB] == 0x34 ) && ( testMspfg.reg[MSPFG_CAP_FULL_MSB] == 0x12 ),
+         "cap full 0x%02X%02X", testMspfg.reg[MSPFG_CAP_FULL_MSB], testMspfg.reg[MSPFG_CAP_FULL_LSB] );
+  CHECK( mspfg_setFuelLvlCritThresh( 15 ) && ( testMspfg.reg[MSPFG_FUEL_LVL_CRIT_THRESH] == 15 ), "threshold" );
+  CHECK( !mspfg_setFuelLvlCritThresh( MSPFG_FUEL_LVL_MAX + 1 ), "threshold above range accepted" );
+  CHECK( testMspfg.reg[MSPFG_FUEL_LVL_CRIT_THRESH] == 15, "rejected threshold written" );
+  CHECK( mspfg_writeReg( MSPFG_FUEL_LVL, 77 ) && ( testMspfg.reg[MSPFG_FUEL_LVL] == 0 ), "level register writable" );
+
+  // Nothing is measured until continuous collection is started
+  CHECK( !testMspfgMeasure( 0x0900 ), "measured while stopped" );
+  CHECK( mspfg_sendCommand( MSPFG_CMD_ST_CONT_DATA ) && testMspfg.cont, "start continuous" );
+
+  // Snapshot: one register write and one burst read, decoded consistently
+  CHECK( testMspfgMeasure( 0x091A ), "no measurement" );
+  testMspfg.numWrites = testMspfg.numReads = 0;
+  testMspfg.busBits = 0;
+  CHECK( mspfg_readSnapshot( &snap ), "snapshot read" );
+  CHECK( ( testMspfg.numWrites == 1 ) && ( testMspfg.numReads == 1 ), "snapshot took %u writes %u reads",
+         testMspfg.numWrites, testMspfg.numReads );
+  CHECK( !testMspfg.intAsserted, "MSP_INT still asserted" );
+  CHECK( snap.capFull == 0x1234, "capFull 0x%04X", snap.capFull );
+  CHECK( ( snap.capAlgo == 0x091A ) && ( snap.capRaw == 0x091A ), "caps 0x%04X 0x%04X", snap.capAlgo, snap.capRaw );
+  CHECK( snap.fuelLvlCritThresh == 15, "threshold %u", snap.fuelLvlCritThresh );
+  CHECK( snap.fuelLvl == (uint32)0x091A * MSPFG_FUEL_LVL_MAX / 0x1234, "level %u", snap.fuelLvl );
+  printf( "  fuel snapshot burst           %6.1f us on the bus\n",
+          testMspfg.busBits * 1e6 / TEST_I2C_CLOCK );
+
+  // Capacitance burst skips the level registers
+  CHECK( testMspfgMeasure( 0x0B1A ), "no measurement" );
+  testMspfg.busBits = 0;
+  CHECK( mspfg_readCaps( &capAlgo, &capRaw ), "caps read" );
+  CHECK( ( capAlgo == 0x0A1A ) && ( capRaw == 0x0B1A ), "caps 0x%04X 0x%04X", capAlgo, capRaw );
+  printf( "  fuel capacitance burst        %6.1f us on the bus\n",
+          testMspfg.busBits * 1e6 / TEST_I2C_CLOCK );
+
+  // Single shot after stopping
+  CHECK( mspfg_sendCommand( MSPFG_CMD_SP_CONT_DATA ) && !testMspfg.cont, "stop continuous" );
+  CHECK( !testMspfgMeasure( 0x0C00 ), "measured after stop" );
+  CHECK( mspfg_sendCommand( MSPFG_CMD_SINGLESHOT_DATA ), "single shot" );
+  CHECK( testMspfgMeasure( 0x0C00 ) && !testMspfgMeasure( 0x0C00 ), "single shot took more than one measurement" );
+
+  // Full tank clips at MSPFG_FUEL_LVL_MAX
+  CHECK( mspfg_setCapFull( 0x0400 ) && mspfg_sendCommand( MSPFG_CMD_SINGLESHOT_DATA ), "reprogram" );
+  CHECK( testMspfgMeasure( 0x0C00 ) && mspfg_readSnapshot( &snap ), "snapshot read" );
+  CHECK( snap.fuelLvl == MSPFG_FUEL_LVL_MAX, "clipped level %u", snap.fuelLvl );
+
+  // Missing gauge: every access fails
+  testMspfg.present = FALSE;
+  CHECK( !mspfg_sendCommand( MSPFG_CMD_ST_CONT_DATA ), "command to a missing gauge" );
+  CHECK( !mspfg_readSnapshot( &snap ), "snapshot from a missing gauge" );
+  CHECK( !mspfg_readCaps( &capAlgo, &capRaw ), "caps from a missing gauge" );
+  CHECK( !mspfg_setFuelLvlCritThresh( 15 ), "threshold to a missing gauge" );
+  testMspfg.present = TRUE;
+
+} // testMspfgDriver
+
+// Drains the tank through the gauge model and measures how long after the true
+// level crosses the threshold the gauge's level follows. The alarm path reads
+// the snapshot on the MSP_INT edge and compares the unfiltered level, as
+// MSPFG_dataRdyIntHdlr does; the slosh filtered level is tracked alongside to
+// show what checking after the filter would cost.
+static void testCritTracking( void )
+{
+  mspfgSnapshot_t snap;
+  const uint16 capFull = 40000;
+  int32 tCross = -1, tRaw = -1, tFilt = -1;
+
+  testMspfgReset();
+  VOID mspfg_setCapFull( capFull );
+  VOID mspfg_setFuelLvlCritThresh( TEST_CRIT_THRESH );
+  VOID mspfg_sendCommand( MSPFG_CMD_ST_CONT_DATA );
+  mujoeFuelEst_init();
+
+  for( int32 t = 0; ( t < 120000 ) && ( ( tRaw < 0 ) || ( tFilt < 0 ) ); t += TEST_CRIT_PERIOD )
+  {
+    // True level (0.01 %), crossed once the gauge's whole percent reads it
+    int32 lvl = 3000 - TEST_CRIT_DRAIN * t / 1000;
+    if( ( tCross < 0 ) && ( lvl / 100 <= TEST_CRIT_THRESH ) )
+      tCross = t;
+
+    VOID testMspfgMeasure( (uint16)( (int32)capFull * lvl / 10000 ) );
+    if( !testMspfg.intAsserted )
+      continue;
+
+    if( !mspfg_readSnapshot( &snap ) )
+      break;
+
+    if( ( tRaw < 0 ) && ( snap.fuelLvl <= snap.fuelLvlCritThresh ) )
+      tRaw = t;
+
+    mujoeFuelEst_update( (int16)snap.fuelLvl * 100, TEST_CRIT_ACTIVITY );
+    if( ( tFilt < 0 ) && ( mujoeFuelEst_getLevel() <= TEST_CRIT_THRESH * 100 ) )
+      tFilt = t;
+  }
+
+  CHECK( ( tCross >= 0 ) && ( tRaw >= 0 ) && ( tFilt >= 0 ), "no crossing %d %d %d", tCross, tRaw, tFilt );
+
+  // The gauge's own tracking step holds it back by up to two measurements
+  CHECK( ( tRaw >= tCross ) && ( tRaw - tCross <= 2 * TEST_CRIT_PERIOD ), "unfiltered alarm %d ms late", tRaw - tCross );
+  CHECK( tRaw <= tFilt, "filtered level crossed first" );
+
+  printf( "  crit alarm, crossing to edge  %6d ms unfiltered, %d ms filtered\n",
+          tRaw - tCross, tFilt - tCross );
+
+} // testCritTracking
+
+static void testTimestamp( void )
+{
+  testSetSleepTimer( 0x00FFFF00 );
+  mujoeTimestamp_init();
+  uint32 t0 = mujoeTimestamp_now();
+  testSetSleepTimer( 0x00000100 );
+  uint32 t1 = mujoeTimestamp_now();
+  CHECK( t1 - t0 == 0x200, "rollover difference %lu", (unsigned long)( t1 - t0 ) );
+
+  CHECK( mujoeTimestamp_toMs( TS_TICKS_PER_SEC * 3 ) == 3000, "3 s -> %lu ms",
+         (unsigned long)mujoeTimestamp_toMs( TS_TICKS_PER_SEC * 3 ) );
+  CHECK( mujoeTimestamp_msToTicks( 125 ) == 4096, "125 ms -> %lu ticks",
+         (unsigned long)mujoeTimestamp_msToTicks( 125 ) );
+
+  // Irregular intervals add up to the elapsed time without drift
+  mujoeTimestampDt_t dt = { 0, 0 };
+  uint32 now = 0;
+  uint32 sum = 0;
+  for( uint32 i = 0; i < 5000; i++ )
+  {
+    now += 300 + ( i * 37 ) % 400;
+    sum += mujoeTimestamp_takeDtMs( &dt, now );
+  }
+  CHECK( sum == mujoeTimestamp_toMs( now ), "dt sum %lu ms, elapsed %lu ms",
+         (unsigned long)sum, (unsigned long)mujoeTimestamp_toMs( now ) );
+
+} // testTimestamp
+
+static void testSampleRing( void )
+{
+  mujoeSampleRingCursor_t cur, fresh;
+  int16 xyz[3] = { 0, 0, 0 };
+
+  mujoeSampleRing_init();
+  mujoeSampleRing_initCursor( SRING_CH_ACCEL, &cur );
+  mujoeSampleRing_initCursor( SRING_CH_ACCEL, &fresh );
+
+  // A reader 300 samples behind, more than an 8-bit count holds
+  for( int16 i = 0; i < 300; i++ )
+  {
+    xyz[0] = i;
+    mujoeSampleRing_pushAccel( (uint32)i, xyz );
+  }
+
+  uint8 idx = mujoeSampleRing_next( SRING_CH_ACCEL, &cur );
+  CHECK( ( idx != SRING_NONE ) && ( mujoeSampleRing.accX[idx] == 300 - SRING_DEPTH ),
+         "oldest held sample %d", ( idx != SRING_NONE ) ? mujoeSampleRing.accX[idx] : -1 );
+  CHECK( cur.lost == 0xFF, "lost %u, expected saturation", cur.lost );
+
+  uint8 n = 1;
+  while( mujoeSampleRing_next( SRING_CH_ACCEL, &cur ) != SRING_NONE )
+    n++;
+  CHECK( n == SRING_DEPTH, "%u samples read back", n );
+
+  idx = mujoeSampleRing_latest( SRING_CH_ACCEL, &fresh );
+  CHECK( ( idx != SRING_NONE ) && ( mujoeSampleRing.accX[idx] == 299 ), "latest sample" );
+  CHECK( mujoeSampleRing_latest( SRING_CH_ACCEL, &fresh ) == SRING_NONE, "latest read twice" );
+
+  // The aux channel carries values of several slots, each tagged with its slot
+  mujoeSampleRing_initCursor( SRING_CH_AUX, &cur );
+  mujoeSampleRing_pushAux( 1, 3, -70000L );
+  mujoeSampleRing_pushAux( 2, 5, 123456L );
+  idx = mujoeSampleRing_next( SRING_CH_AUX, &cur );
+  CHECK( ( idx != SRING_NONE ) && ( mujoeSampleRing.auxSlot[idx] == 3 ) &&
+         ( mujoeSampleRing.auxVal[idx] == -70000L ), "aux sample of slot 3" );
+  idx = mujoeSampleRing_next( SRING_CH_AUX, &cur );
+  CHECK( ( idx != SRING_NONE ) && ( mujoeSampleRing.auxSlot[idx] == 5 ) &&
+         ( mujoeSampleRing.auxVal[idx] == 123456L ), "aux sample of slot 5" );
+  CHECK( mujoeSampleRing.count[SRING_CH_ACCEL] == 300, "aux pushes leave the accel channel alone" );
+
+} // testSampleRing
+
+////////////////////////////////////////////////////////////////////////////////
+// MAIN
+////////////////////////////////////////////////////////////////////////////////
+
+int main( void )
+{
+  testMs5Compensation();
+  testVarioAltitude();
+  testVarioFusion();
+  testRpm();
+  testFuelEst();
+  testFuelBurn();
+  testTankLut();
+  testMspfgDriver();
+  testCritTracking();
+  testTimestamp();
+  testSampleRing();
+
+  printf( "%d checks, %d failed\n", testNum, testFail );
+  return ( testFail == 0 ) ? 0 : 1;
+
+} // main
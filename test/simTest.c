@@ -0,0 +1,1223 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: simTest.c
+// @author: Joseph Corteo Jr.
+//
+// Host simulation of the firmware: mainTask and sensorMgrTask run unmodified
+// under a stand-in OSAL scheduler, against register models of the barometer,
+// accelerometer, EEPROM and fuel gauge on a simulated I2C bus. The clock only
+// advances with bus traffic and idle time, target CPU time is not modelled.
+// Times the critical fuel alarm from the MSP_INT edge to the notification,
+// and checks the fuel gauge sleeps while the airframe is stationary.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "mainTask.h"
+
+#include "testMspfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+#define CHECK( cond, ... )                                                      \
+  do {                                                                          \
+    testNum++;                                                                  \
+    if( !( cond ) )                                                             \
+    {                                                                           \
+      testFail++;                                                               \
+      printf( "FAIL %s:%d: ", __func__, __LINE__ );                             \
+      printf( __VA_ARGS__ );                                                    \
+      printf( "\n" );                                                           \
+    }                                                                           \
+  } while( 0 )
+
+#define SIM_NS_PER_MS                   1000000ULL
+
+// Task table, highest priority first. Task 0 stands in for the stack's own
+// tasks, which sit ahead of the application on the target; nothing is posted
+// to it here. The GPIO driver treats task id 0 as unassigned.
+#define SIM_TASK_STACK                  0
+#define SIM_TASK_MAIN                   1
+#define SIM_TASK_SENSORMGR              2
+#define SIM_NUM_TASKS                   3
+
+#define SIM_MAX_TIMERS                  32
+#define SIM_MAX_RSP                     64
+
+// I2C write addresses of the parts on the bus
+#define SIM_I2C_BARO                    0xEE
+#define SIM_I2C_EEPROM                  0xA0
+
+// Fuel gauge: continuous mode measurement period (ms), and CAP_FULL as
+// calibrated at the factory
+#define SIM_MSPFG_PERIOD                500
+#define SIM_MSPFG_CAP_FULL              4000
+
+// Barometer: datasheet example conversions, varied by a few codes per sample so
+// the stuck detector stays quiet
+#define SIM_BARO_D1                     6465444UL
+#define SIM_BARO_D2                     8077636UL
+
+// Accelerometer register file size and 1 g at 2 g full scale (10-bit counts)
+#define SIM_MMA_NUM_REGS                ( MMA_REG_OFF_Z + 1 )
+#define SIM_MMA_1G                      256
+
+// EEPROM size and write cycle (ns)
+#define SIM_EEPROM_SIZE                 65536UL
+#define SIM_EEPROM_CYCLE                ( CAT24C512_WRITE_CYCLE_TIME * SIM_NS_PER_MS )
+
+// Async Bulk period requested by the central (ms)
+#define SIM_ASYNCBULK_PERIOD            100
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+typedef uint16 (*simTask_t)( uint8 task_id, uint16 events );
+
+typedef struct simTimer_def
+{
+  bool          used;
+  uint8         taskId;
+  uint16        event;
+  uint64_t      expNs;                  // Expiry on the simulated clock
+
+}simTimer_t;
+
+// OSAL message, the header precedes the payload handed to the tasks
+typedef struct simMsg_def
+{
+  struct simMsg_def     *next;
+
+}simMsg_t;
+
+// Response characteristic writes, i.e. notifications to the central
+typedef struct simRsp_def
+{
+  uint16        code;
+  uint64_t      ns;                     // Simulated time of the write
+  uint32        pass;                   // Index of the scheduler pass it happened in
+  double        host;                   // Host clock (s)
+
+}simRsp_t;
+
+// MS5607: last command, conversion in flight and the PROM
+typedef struct simBaro_def
+{
+  uint16        prom[MS560702_PROM_NUM_WORDS];
+  bool          adcRead;                // ADC read command sent, else PROM read
+  uint8         promAddr;
+  uint32        result;                 // Conversion result, 0 once read
+  uint64_t      doneNs;                 // Conversion complete
+  uint32        numConv;
+
+}simBaro_t;
+
+// MMA8453Q register file. Samples arrive at the ODR of the current system
+// mode; the auto-sleep countdown is not modelled, the tests put the part to
+// sleep and wake it.
+typedef struct simMma_def
+{
+  uint8         reg[SIM_MMA_NUM_REGS];
+  uint8         ptr;
+  uint64_t      nextNs;                 // Next DRDY
+  int16         xyz[MMA_NUM_AXES];      // Input acceleration (counts at 2 g)
+
+}simMma_t;
+
+// CAT24C512: address pointer and write cycle in progress
+typedef struct simEeprom_def
+{
+  uint8         mem[SIM_EEPROM_SIZE];
+  uint16        ptr;
+  uint64_t      busyNs;                 // Write cycle complete
+
+}simEeprom_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// GLOBAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+// CC2541 SFRs, see stub/iocc2541.h
+volatile uint8                  ST0, ST1, ST2;
+volatile uint8                  P0, P1, P2;
+volatile uint8                  P0IEN, P1IEN, P2IEN;
+volatile uint8                  P0INP, P1INP, P2INP;
+volatile uint8                  P0IF, P1IF, P2IF;
+volatile uint8                  PICTL, IEN0, IEN1, IEN2;
+volatile uint8                  XSFR[256];
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+static int                      testNum = 0;
+static int                      testFail = 0;
+
+static const simTask_t          simTasks[SIM_NUM_TASKS] =
+{
+  NULL,
+  mainTask_ProcessEvent,
+  sensorMgrTask_ProcessEvent,
+};
+
+static uint16                   simEvents[SIM_NUM_TASKS];
+static simMsg_t                 *simMsgQ[SIM_NUM_TASKS];
+static simTimer_t               simTimers[SIM_MAX_TIMERS];
+static uint64_t                 simNs = 0;              // Simulated clock
+static uint32                   simPasses = 0;          // Scheduler passes, one event each
+
+// PxIFG flags and the copy handed out by the last access, see hostPortIfg
+static uint8                    simIfg[3];
+static uint8                    simIfgView[3];
+static bool                     simIfgOut[3];
+
+// Central side of the profiles
+static muJoeGenProfileCBs_t     *simGenCBs = NULL;
+static uint16                   simCmd;
+static uint8                    simMailbox[20];
+static simRsp_t                 simRsp[SIM_MAX_RSP];
+static uint8                    simRspNum = 0;
+static uint32                   simAsyncBulkNum = 0;
+
+// Parts on the bus
+static simBaro_t                simBaro;
+static simMma_t                 simMma;
+static simEeprom_t              simEeprom;
+
+// Fuel gauge: raw capacitance it measures and its continuous mode schedule
+static uint16                   simCapRaw;
+static bool                     simMspfgRunning = FALSE;
+static uint64_t                 simMspfgNextNs;
+
+// Critical fuel alarm timing: the measurement that takes the gauge's level to
+// its threshold is recorded, and the Async Bulk timer expired on the same tick
+static bool                     simCritArmed = FALSE;
+static uint64_t                 simCritEdgeNs;
+static uint32                   simCritEdgePass;        // Index of the first pass after the edge
+static bool                     simCritCompeting;       // Async Bulk timer was running and expired
+static uint32                   simCritBulkPass;        // Index of the first pass to write a packet after the edge
+static double                   simCritEdgeHost;
+
+// MS5607 datasheet example coefficients, C1 thru C6
+static const uint16             simBaroProm[MS560702_PROM_NUM_WORDS] =
+{
+  0x0000, 46372, 43981, 29059, 27842, 31553, 28165, 0x0000,
+};
+
+// Conversion time (ns) by OSR index, 256 thru 4096, datasheet maximum
+static const uint32             simBaroConvNs[5] =
+{
+  600000, 1170000, 2280000, 4540000, 9040000,
+};
+
+// Sample period (ns) per system ODR and per sleep ODR
+static const uint32             simMmaOdrNs[8] =
+{
+  1250000, 2500000, 5000000, 10000000, 20000000, 80000000, 160000000, 640000000,
+};
+static const uint32             simMmaSlpOdrNs[4] =
+{
+  20000000, 80000000, 160000000, 640000000,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void PORT0_ISR( void );
+void PORT1_ISR( void );
+
+////////////////////////////////////////////////////////////////////////////////
+// HELPERS
+////////////////////////////////////////////////////////////////////////////////
+
+static double simHostSeconds( void )
+{
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+
+} // simHostSeconds
+
+// Moves the simulated clock and the 32768 Hz sleep timer with it
+static void simSetNs( uint64_t ns )
+{
+  simNs = ns;
+  uint32 st = (uint32)( ( ns * 32768ULL ) / 1000000000ULL );
+  ST0 = (uint8)st;
+  ST1 = (uint8)( st >> 8 );
+  ST2 = (uint8)( st >> 16 );
+
+} // simSetNs
+
+// One transaction of "len" bytes at the board's bus clock
+static void simBusTime( uint8 len )
+{
+  simSetNs( simNs + testI2cBits( len ) * 1000000000ULL / TEST_I2C_CLOCK );
+
+} // simBusTime
+
+// Bit serial CRC4 as given in the MS5607 datasheet
+static uint8 simCrc4( uint16 *prom )
+{
+  uint16 nRem = 0;
+  uint16 crcRead = prom[7];
+
+  prom[7] &= 0xFF00;
+  for( int cnt = 0; cnt < 16; cnt++ )
+  {
+    if( cnt & 1 )
+      nRem ^= prom[cnt >> 1] & 0x00FF;
+    else
+      nRem ^= prom[cnt >> 1] >> 8;
+    for( int bit = 8; bit > 0; bit-- )
+      nRem = ( nRem & 0x8000 ) ? ( nRem << 1 ) ^ 0x3000 : ( nRem << 1 );
+  }
+  prom[7] = crcRead;
+
+  return (uint8)( ( nRem >> 12 ) & 0x000F );
+
+} // simCrc4
+
+////////////////////////////////////////////////////////////////////////////////
+// OSAL
+////////////////////////////////////////////////////////////////////////////////
+
+uint8 osal_set_event( uint8 task_id, uint16 event_flag )
+{
+  if( task_id >= SIM_NUM_TASKS )
+    return INVALID_TASK_ID;
+
+  simEvents[task_id] |= event_flag;
+  return SUCCESS;
+
+} // osal_set_event
+
+uint8 osal_start_timerEx( uint8 task_id, uint16 event_id, uint32 timeout_value )
+{
+  simTimer_t *pFree = NULL;
+
+  for( uint8 i = 0; i < SIM_MAX_TIMERS; i++ )
+  {
+    simTimer_t *pTimer = &simTimers[i];
+    if( pTimer->used && ( pTimer->taskId == task_id ) && ( pTimer->event == event_id ) )
+    {
+      pFree = pTimer;
+      break;
+    }
+    if( !pTimer->used && ( pFree == NULL ) )
+      pFree = pTimer;
+  }
+  if( pFree == NULL )
+    return FAILURE;
+
+  pFree->used = TRUE;
+  pFree->taskId = task_id;
+  pFree->event = event_id;
+  pFree->expNs = simNs + timeout_value * SIM_NS_PER_MS;
+  return SUCCESS;
+
+} // osal_start_timerEx
+
+uint8 osal_stop_timerEx( uint8 task_id, uint16 event_id )
+{
+  for( uint8 i = 0; i < SIM_MAX_TIMERS; i++ )
+  {
+    if( simTimers[i].used && ( simTimers[i].taskId == task_id ) && ( simTimers[i].event == event_id ) )
+    {
+      simTimers[i].used = FALSE;
+      return SUCCESS;
+    }
+  }
+  return FAILURE;
+
+} // osal_stop_timerEx
+
+uint32 osal_GetSystemClock( void )
+{
+  return (uint32)( simNs / SIM_NS_PER_MS );
+
+} // osal_GetSystemClock
+
+void *osal_mem_alloc( uint16 size )
+{
+  return malloc( size );
+
+} // osal_mem_alloc
+
+void osal_mem_free( void *ptr )
+{
+  free( ptr );
+
+} // osal_mem_free
+
+uint8 *osal_msg_allocate( uint16 len )
+{
+  simMsg_t *pHdr = malloc( sizeof( simMsg_t ) + len );
+  if( pHdr == NULL )
+    return NULL;
+
+  pHdr->next = NULL;
+  return (uint8 *)( pHdr + 1 );
+
+} // osal_msg_allocate
+
+uint8 osal_msg_deallocate( uint8 *msg_ptr )
+{
+  free( (simMsg_t *)msg_ptr - 1 );
+  return SUCCESS;
+
+} // osal_msg_deallocate
+
+uint8 osal_msg_send( uint8 destination_task, uint8 *msg_ptr )
+{
+  if( destination_task >= SIM_NUM_TASKS )
+  {
+    VOID osal_msg_deallocate( msg_ptr );
+    return INVALID_TASK_ID;
+  }
+
+  simMsg_t *pHdr = (simMsg_t *)msg_ptr - 1;
+  simMsg_t **ppTail = &simMsgQ[destination_task];
+  while( *ppTail != NULL )
+    ppTail = &( *ppTail )->next;
+  *ppTail = pHdr;
+
+  simEvents[destination_task] |= SYS_EVENT_MSG;
+  return SUCCESS;
+
+} // osal_msg_send
+
+// Hands out the oldest message, and re-flags SYS_EVENT_MSG if more are queued
+uint8 *osal_msg_receive( uint8 task_id )
+{
+  simMsg_t *pHdr = simMsgQ[task_id];
+  if( pHdr == NULL )
+    return NULL;
+
+  simMsgQ[task_id] = pHdr->next;
+  if( simMsgQ[task_id] != NULL )
+    simEvents[task_id] |= SYS_EVENT_MSG;
+  return (uint8 *)( pHdr + 1 );
+
+} // osal_msg_receive
+
+// Expires a running timer on the current tick, FALSE if it is not running
+static bool simTimerExpire( uint8 task_id, uint16 event_id )
+{
+  for( uint8 i = 0; i < SIM_MAX_TIMERS; i++ )
+  {
+    if( simTimers[i].used && ( simTimers[i].taskId == task_id ) && ( simTimers[i].event == event_id ) )
+    {
+      simTimers[i].expNs = simNs;
+      return TRUE;
+    }
+  }
+  return FALSE;
+
+} // simTimerExpire
+
+// One pass of the OSAL loop: the highest priority task with events gets them
+// and hands back those it left
+static bool simPass( void )
+{
+  for( uint8 id = 0; id < SIM_NUM_TASKS; id++ )
+  {
+    if( simEvents[id] == 0 )
+      continue;
+
+    uint16 events = simEvents[id];
+    simEvents[id] = 0;
+    if( simTasks[id] != NULL )
+      events = simTasks[id]( id, events );
+    else
+      events = 0;
+    simEvents[id] |= events;
+    simPasses++;
+    return TRUE;
+  }
+  return FALSE;
+
+} // simPass
+
+////////////////////////////////////////////////////////////////////////////////
+// PORTS
+////////////////////////////////////////////////////////////////////////////////
+
+static void simIfgCommit( uint8 port )
+{
+  if( !simIfgOut[port] )
+    return;
+
+  simIfg[port] &= simIfgView[port];
+  simIfgOut[port] = FALSE;
+
+} // simIfgCommit
+
+// A write of the handed out copy clears the flags written as 0, a plain read
+// leaves it equal to the flags. The sim only raises flags after a commit.
+volatile uint8 *hostPortIfg( uint8 port )
+{
+  simIfgCommit( port );
+  simIfgView[port] = simIfg[port];
+  simIfgOut[port] = TRUE;
+  return &simIfgView[port];
+
+} // hostPortIfg
+
+static uint8 simInputMask( uint8 port )
+{
+  uint8 mask = 0;
+  for( uint8 i = 0; i < PINID_NUMGPIOS; i++ )
+  {
+    if( ( gpioPinTable[i].port == port ) && !( gpioPinTable[i].cfg & PINCFG_OUTPUT ) )
+      mask |= 0x01 << gpioPinTable[i].pin;
+  }
+  return mask;
+
+} // simInputMask
+
+static void simPinLow( uint8 *pLevels, mujoegpio_pinid_t pinId )
+{
+  pLevels[gpioPinTable[pinId].port] &= ~( 0x01 << gpioPinTable[pinId].pin );
+
+} // simPinLow
+
+// Drives the input pins of ports 0 and 1 to "pLevels", flags the edges PICTL
+// selects and runs the port ISR if an unmasked pin has its flag up
+static void simDrivePorts( uint8 *pLevels )
+{
+  for( uint8 port = 0; port < 2; port++ )
+  {
+    volatile uint8 *pPort = ( port == 0 ) ? &P0 : &P1;
+    uint8 mask = simInputMask( port );
+    uint8 prev = *pPort;
+    uint8 now = (uint8)( ( prev & ~mask ) | ( pLevels[port] & mask ) );
+    *pPort = now;
+
+    uint8 fall = prev & ~now;
+    uint8 rise = now & ~prev;
+    uint8 edges;
+    if( port == 0 )
+      edges = ( PICTL & 0x01 ) ? fall : rise;
+    else
+      edges = (uint8)( ( ( PICTL & 0x02 ) ? fall : rise ) & 0x0F ) |
+              (uint8)( ( ( PICTL & 0x04 ) ? fall : rise ) & 0xF0 );
+
+    simIfgCommit( port );
+    simIfg[port] |= edges;
+
+    if( port == 0 )
+    {
+      if( ( simIfg[0] & P0IEN ) && ( IEN1 & 0x20 ) )
+      {
+        P0IF = 1;
+        PORT0_ISR();
+      }
+    }
+    else
+    {
+      if( ( simIfg[1] & P1IEN ) && ( IEN2 & 0x10 ) )
+      {
+        P1IF = 1;
+        PORT1_ISR();
+      }
+    }
+  }
+
+} // simDrivePorts
+
+////////////////////////////////////////////////////////////////////////////////
+// BAROMETER MODEL
+////////////////////////////////////////////////////////////////////////////////
+
+static void simBaroReset( void )
+{
+  memset( &simBaro, 0, sizeof( simBaro ) );
+  memcpy( simBaro.prom, simBaroProm, sizeof( simBaro.prom ) );
+  simBaro.prom[7] = simCrc4( simBaro.prom );
+
+} // simBaroReset
+
+static uint8 simBaroWrite( uint8 len, uint8 *pBuf )
+{
+  if( len != 1 )
+    return 0;
+
+  uint8 cmd = pBuf[0];
+  if( cmd == MS5_CMD_RESET )
+    simBaro.result = 0;
+  else if( cmd == MS5_CMD_ADC_READ )
+    simBaro.adcRead = TRUE;
+  else if( ( cmd & 0xF0 ) == MS5_CMD_PROM_RD )
+  {
+    simBaro.adcRead = FALSE;
+    simBaro.promAddr = ( cmd >> 1 ) & 0x07;
+  }
+  else if( ( cmd & 0xE0 ) == MS5_CMD_ADC_CONV )
+  {
+    int32 jitter = (int32)( simBaro.numConv++ % 7 ) - 3;
+    simBaro.result = ( ( cmd & MS5_CMD_ADC_D2 ) ? SIM_BARO_D2 : SIM_BARO_D1 ) + jitter;
+    simBaro.doneNs = simNs + simBaroConvNs[( ( cmd & 0x0F ) >> 1 ) % 5];
+  }
+  return len;
+
+} // simBaroWrite
+
+// A conversion read before it completes reads 0, as on the part
+static uint8 simBaroRead( uint8 len, uint8 *pBuf )
+{
+  if( simBaro.adcRead )
+  {
+    if( len != 3 )
+      return 0;
+    uint32 val = ( simNs >= simBaro.doneNs ) ? simBaro.result : 0;
+    simBaro.result = 0;
+    pBuf[0] = (uint8)( val >> 16 );
+    pBuf[1] = (uint8)( val >> 8 );
+    pBuf[2] = (uint8)val;
+    return len;
+  }
+
+  if( len != 2 )
+    return 0;
+  pBuf[0] = (uint8)( simBaro.prom[simBaro.promAddr] >> 8 );
+  pBuf[1] = (uint8)simBaro.prom[simBaro.promAddr];
+  return len;
+
+} // simBaroRead
+
+////////////////////////////////////////////////////////////////////////////////
+// ACCELEROMETER MODEL
+////////////////////////////////////////////////////////////////////////////////
+
+static void simMmaReset( void )
+{
+  memset( &simMma, 0, sizeof( simMma ) );
+  simMma.reg[MMA_REG_WHO_AM_I] = MMA845xQ_WHO_AM_I_ID;
+  simMma.xyz[2] = SIM_MMA_1G;
+
+} // simMmaReset
+
+static uint8 simMmaSysMode( void )
+{
+  return simMma.reg[MMA_REG_SYSMOD] & 0x03;
+
+} // simMmaSysMode
+
+static uint64_t simMmaPeriodNs( void )
+{
+  uint8 ctrl1 = simMma.reg[MMA_REG_CTRL_REG1];
+  if( simMmaSysMode() == MMA_SYSMOD_SLEEP )
+    return simMmaSlpOdrNs[ctrl1 >> 6];
+  return simMmaOdrNs[( ctrl1 & MMA_CTRL_REG1_ODR_MASK ) >> 3];
+
+} // simMmaPeriodNs
+
+// Raises interrupt sources the part has enabled
+static void simMmaIntSrc( uint8 src )
+{
+  simMma.reg[MMA_REG_INT_SOURCE] |= src & simMma.reg[MMA_REG_CTRL_REG4];
+
+} // simMmaIntSrc
+
+// TRUE while INT1 (or INT2) is asserted
+static bool simMmaInt( bool int1 )
+{
+  uint8 route = int1 ? simMma.reg[MMA_REG_CTRL_REG5] : (uint8)~simMma.reg[MMA_REG_CTRL_REG5];
+  return ( simMma.reg[MMA_REG_INT_SOURCE] & simMma.reg[MMA_REG_CTRL_REG4] & route ) ? TRUE : FALSE;
+
+} // simMmaInt
+
+// Enters auto-sleep, as the part does once ASLP_COUNT runs out without motion
+static void simAccelSleep( void )
+{
+  if( !( simMma.reg[MMA_REG_CTRL_REG2] & MMA_CTRL_REG2_SLPE ) || ( simMmaSysMode() != MMA_SYSMOD_WAKE ) )
+    return;
+
+  simMma.reg[MMA_REG_SYSMOD] = MMA_SYSMOD_SLEEP;
+  simMma.nextNs = simNs + simMmaPeriodNs();
+  simMmaIntSrc( MMA_INT_SOURCE_SRC_ASLP );
+
+} // simAccelSleep
+
+// A transient on Z, which wakes the part if it is set to wake on one
+static void simAccelMotion( void )
+{
+  simMma.reg[MMA_REG_TRANSIENT_SRC] = 0x60;     // EA, Z event
+  simMmaIntSrc( MMA_INT_SOURCE_SRC_TRANS );
+
+  if( ( simMmaSysMode() == MMA_SYSMOD_SLEEP ) && ( simMma.reg[MMA_REG_CTRL_REG3] & MMA_CTRL_REG3_WAKE_TRANS ) )
+  {
+    simMma.reg[MMA_REG_SYSMOD] = MMA_SYSMOD_WAKE;
+    simMma.nextNs = simNs + simMmaPeriodNs();
+    simMmaIntSrc( MMA_INT_SOURCE_SRC_ASLP );
+  }
+
+} // simAccelMotion
+
+static void simMmaDrdy( void )
+{
+  uint8 shift = simMma.reg[MMA_REG_XYZ_DATA_CFG] & 0x03;
+
+  if( simMma.reg[MMA_REG_STATUS] & MMA_STATUS_ZYXDR )
+    simMma.reg[MMA_REG_STATUS] |= MMA_STATUS_ZYXOW;
+  simMma.reg[MMA_REG_STATUS] |= MMA_STATUS_ZYXDR | 0x07;
+
+  // 10-bit data, left justified over MSB/LSB
+  for( uint8 i = 0; i < MMA_NUM_AXES; i++ )
+  {
+    uint16 val = (uint16)( ( simMma.xyz[i] >> shift ) << 6 );
+    simMma.reg[MMA_REG_OUT_X_MSB + 2*i] = (uint8)( val >> 8 );
+    simMma.reg[MMA_REG_OUT_X_LSB + 2*i] = (uint8)val;
+  }
+  simMmaIntSrc( MMA_INT_SOURCE_SRC_DRDY );
+
+} // simMmaDrdy
+
+static uint8 simMmaWrite( uint8 len, uint8 *pBuf )
+{
+  if( len == 0 )
+    return 0;
+
+  uint8 wasActive = simMma.reg[MMA_REG_CTRL_REG1] & MMA_CTRL_REG1_ACTIVE;
+
+  simMma.ptr = pBuf[0];
+  for( uint8 i = 1; i < len; i++ )
+  {
+    uint8 r = simMma.ptr++;
+    if( ( r >= MMA_REG_XYZ_DATA_CFG ) && ( r < SIM_MMA_NUM_REGS ) &&
+        ( r != MMA_REG_PL_STATUS ) && ( r != MMA_REG_FF_MT_SRC ) &&
+        ( r != MMA_REG_TRANSIENT_SRC ) && ( r != MMA_REG_PULSE_SRC ) )
+      simMma.reg[r] = pBuf[i];
+  }
+
+  uint8 active = simMma.reg[MMA_REG_CTRL_REG1] & MMA_CTRL_REG1_ACTIVE;
+  if( active && !wasActive )
+  {
+    simMma.reg[MMA_REG_SYSMOD] = MMA_SYSMOD_WAKE;
+    simMma.nextNs = simNs + simMmaPeriodNs();
+  }
+  else if( !active && wasActive )
+    simMma.reg[MMA_REG_SYSMOD] = MMA_SYSMOD_STANDBY;
+  return len;
+
+} // simMmaWrite
+
+// Reads clear the sources they service: the last data byte clears DRDY, the
+// event source registers their events and SYSMOD the sleep/wake flag
+static uint8 simMmaRead( uint8 len, uint8 *pBuf )
+{
+  bool fRead = ( simMma.reg[MMA_REG_CTRL_REG1] & MMA_CTRL_REG1_F_READ ) ? TRUE : FALSE;
+
+  for( uint8 i = 0; i < len; i++ )
+  {
+    uint8 r = simMma.ptr;
+    pBuf[i] = ( r < SIM_MMA_NUM_REGS ) ? simMma.reg[r] : 0;
+    simMma.ptr = ( fRead && ( r >= MMA_REG_OUT_X_MSB ) && ( r < MMA_REG_OUT_Z_MSB ) ) ? r + 2 : r + 1;
+
+    if( r == ( fRead ? MMA_REG_OUT_Z_MSB : MMA_REG_OUT_Z_LSB ) )
+    {
+      simMma.reg[MMA_REG_STATUS] = 0;
+      simMma.reg[MMA_REG_INT_SOURCE] &= ~MMA_INT_SOURCE_SRC_DRDY;
+    }
+    else if( r == MMA_REG_SYSMOD )
+      simMma.reg[MMA_REG_INT_SOURCE] &= ~MMA_INT_SOURCE_SRC_ASLP;
+    else if( r == MMA_REG_FF_MT_SRC )
+    {
+      simMma.reg[MMA_REG_FF_MT_SRC] = 0;
+      simMma.reg[MMA_REG_INT_SOURCE] &= ~MMA_INT_SOURCE_SRC_FF_MT;
+    }
+    else if( r == MMA_REG_TRANSIENT_SRC )
+    {
+      simMma.reg[MMA_REG_TRANSIENT_SRC] = 0;
+      simMma.reg[MMA_REG_INT_SOURCE] &= ~MMA_INT_SOURCE_SRC_TRANS;
+    }
+  }
+  return len;
+
+} // simMmaRead
+
+////////////////////////////////////////////////////////////////////////////////
+// EEPROM MODEL
+////////////////////////////////////////////////////////////////////////////////
+
+static void simEepromReset( void )
+{
+  memset( &simEeprom, 0, sizeof( simEeprom ) );
+  memset( simEeprom.mem, 0xFF, sizeof( simEeprom.mem ) );
+
+} // simEepromReset
+
+// Two address bytes, then data written within the 128 byte page. The part
+// does not acknowledge while a write cycle runs.
+static uint8 simEepromWrite( uint8 len, uint8 *pBuf )
+{
+  if( ( simNs < simEeprom.busyNs ) || ( len < 2 ) )
+    return 0;
+
+  simEeprom.ptr = (uint16)( ( (uint16)pBuf[0] << 8 ) + pBuf[1] );
+  if( len == 2 )
+    return len;
+
+  uint16 page = simEeprom.ptr & ~( CAT24C512_PAGE_SIZE - 1 );
+  for( uint8 i = 2; i < len; i++ )
+    simEeprom.mem[page + ( ( simEeprom.ptr + i - 2 ) & ( CAT24C512_PAGE_SIZE - 1 ) )] = pBuf[i];
+  simEeprom.busyNs = simNs + SIM_EEPROM_CYCLE;
+  return len;
+
+} // simEepromWrite
+
+static uint8 simEepromRead( uint8 len, uint8 *pBuf )
+{
+  if( simNs < simEeprom.busyNs )
+    return 0;
+
+  for( uint8 i = 0; i < len; i++ )
+    pBuf[i] = simEeprom.mem[simEeprom.ptr++];
+  return len;
+
+} // simEepromRead
+
+////////////////////////////////////////////////////////////////////////////////
+// BUS STUBS
+////////////////////////////////////////////////////////////////////////////////
+
+void mujoeI2C_initHardware( i2cClock_t clockRate )
+{
+  VOID clockRate;
+
+} // mujoeI2C_initHardware
+
+uint8 mujoeI2C_write( uint8 addr, uint8 len, uint8 *pBuf, uint8 stp )
+{
+  VOID stp;
+  simBusTime( len );
+
+  switch( addr )
+  {
+  case MSPFG_DEFAULT_I2C_ADDR:
+    return testMspfgWrite( len, pBuf );
+  case SIM_I2C_BARO:
+    return simBaroWrite( len, pBuf );
+  case MMA845xQ_DEFAULT_I2C_WRITE_ADDR:
+    return simMmaWrite( len, pBuf );
+  case SIM_I2C_EEPROM:
+    return simEepromWrite( len, pBuf );
+  default:
+    return 0;
+  }
+
+} // mujoeI2C_write
+
+uint8 mujoeI2C_read( uint8 addr, uint8 len, uint8 *pBuf )
+{
+  simBusTime( len );
+
+  switch( addr )
+  {
+  case MSPFG_DEFAULT_I2C_ADDR:
+    return testMspfgRead( len, pBuf );
+  case SIM_I2C_BARO:
+    return simBaroRead( len, pBuf );
+  case MMA845xQ_DEFAULT_I2C_WRITE_ADDR:
+    return simMmaRead( len, pBuf );
+  case SIM_I2C_EEPROM:
+    return simEepromRead( len, pBuf );
+  default:
+    return 0;
+  }
+
+} // mujoeI2C_read
+
+bool mujoeI2C_ackPoll( uint8 slaWriteAddr )
+{
+  simBusTime( 0 );
+
+  switch( slaWriteAddr )
+  {
+  case MSPFG_DEFAULT_I2C_ADDR:
+    return testMspfg.present;
+  case SIM_I2C_EEPROM:
+    return ( simNs >= simEeprom.busyNs ) ? TRUE : FALSE;
+  case SIM_I2C_BARO:
+  case MMA845xQ_DEFAULT_I2C_WRITE_ADDR:
+    return TRUE;
+  default:
+    return FALSE;
+  }
+
+} // mujoeI2C_ackPoll
+
+bool mujoeI2C_i2cPingSlave( uint8 slaWriteAddr )
+{
+  return mujoeI2C_ackPoll( slaWriteAddr );
+
+} // mujoeI2C_i2cPingSlave
+
+////////////////////////////////////////////////////////////////////////////////
+// STACK AND PROFILE STUBS
+////////////////////////////////////////////////////////////////////////////////
+
+bStatus_t GAPRole_SetParameter( uint16 param, uint8 len, void *pValue ) { return SUCCESS; }
+bStatus_t GAPRole_GetParameter( uint16 param, void *pValue ) { return SUCCESS; }
+bStatus_t GAPRole_StartDevice( gapRolesCBs_t *pAppCallbacks ) { return SUCCESS; }
+bStatus_t GAPRole_SendUpdateParam( uint16 minConnInterval, uint16 maxConnInterval,
+                                   uint16 latency, uint16 connTimeout, uint8 handleFailure ) { return SUCCESS; }
+bStatus_t GAP_SetParamValue( uint16 paramID, uint16 paramValue ) { return SUCCESS; }
+bStatus_t GAPBondMgr_SetParameter( uint16 param, uint8 len, void *pValue ) { return SUCCESS; }
+bStatus_t GAPBondMgr_Register( gapBondCBs_t *pCB ) { return SUCCESS; }
+bStatus_t GGS_SetParameter( uint8 param, uint8 len, void *value ) { return SUCCESS; }
+bStatus_t GGS_AddService( uint32 services ) { return SUCCESS; }
+bStatus_t GATTServApp_AddService( uint32 services ) { return SUCCESS; }
+bStatus_t DevInfo_AddService( void ) { return SUCCESS; }
+bStatus_t DevInfo_SetParameter( uint8 param, uint8 len, void *value ) { return SUCCESS; }
+bStatus_t HCI_EXT_ClkDivOnHaltCmd( uint8 control ) { return SUCCESS; }
+void GATT_bm_free( gattMsg_t *pMsg, uint8 opcode ) { }
+
+bStatus_t MuJoeGenericProfile_AddService( void ) { return SUCCESS; }
+bStatus_t muJoeGenProfile_writeCommand( uint16 commandValue ) { return SUCCESS; }
+bStatus_t muJoeGenProfile_writeDeviceInfo( uint16 hwVer, uint16 fwVer ) { return SUCCESS; }
+void muJoeGenProfile_clearMailbox( void ) { }
+bStatus_t MuJoeDataProfile_AddService( void ) { return SUCCESS; }
+bStatus_t muJoeDataProfile_RegisterAppCBs( muJoeDataProfileCBs_t *appCallbacks ) { return SUCCESS; }
+void muJoeDataProfile_clearAsyncBulk( void ) { }
+void muJoeDataProfile_clearSyncBulk( void ) { }
+
+bStatus_t muJoeGenProfile_RegisterAppCBs( muJoeGenProfileCBs_t *appCallbacks )
+{
+  simGenCBs = appCallbacks;
+  return SUCCESS;
+
+} // muJoeGenProfile_RegisterAppCBs
+
+bStatus_t muJoeGenProfile_readCommand( uint16 *pCommandValue )
+{
+  *pCommandValue = simCmd;
+  return SUCCESS;
+
+} // muJoeGenProfile_readCommand
+
+bStatus_t muJoeGenProfile_readMailbox( uint8 *pMailboxBuff, uint8 buffSize )
+{
+  memcpy( pMailboxBuff, simMailbox, ( buffSize < sizeof( simMailbox ) ) ? buffSize : sizeof( simMailbox ) );
+  return SUCCESS;
+
+} // muJoeGenProfile_readMailbox
+
+// The notification buffer: every Response write is logged with its time
+bStatus_t muJoeGenProfile_writeResponse( uint16 responseValue )
+{
+  if( simRspNum < SIM_MAX_RSP )
+  {
+    simRsp_t *pRsp = &simRsp[simRspNum++];
+    pRsp->code = responseValue;
+    pRsp->ns = simNs;
+    pRsp->pass = simPasses;
+    pRsp->host = simHostSeconds();
+  }
+  return SUCCESS;
+
+} // muJoeGenProfile_writeResponse
+
+bStatus_t muJoeDataProfile_writeAsyncBulk( uint8 *pAsyncBulkBuff, uint8 buffSize )
+{
+  if( !simCritArmed && ( simCritBulkPass < simCritEdgePass ) )
+    simCritBulkPass = simPasses;
+  simAsyncBulkNum++;
+  return SUCCESS;
+
+} // muJoeDataProfile_writeAsyncBulk
+
+////////////////////////////////////////////////////////////////////////////////
+// SIMULATION
+////////////////////////////////////////////////////////////////////////////////
+
+// Gauge measurement on its own schedule. The one that takes the level to the
+// threshold is the alarm's reference edge; the Async Bulk period expires on
+// the same tick so the alarm has to queue behind a competing event.
+static void simMspfgTick( void )
+{
+  bool collecting = ( testMspfg.cont || testMspfg.single ) ? TRUE : FALSE;
+
+  if( !collecting )
+  {
+    simMspfgRunning = FALSE;
+    return;
+  }
+  if( !simMspfgRunning )
+  {
+    simMspfgRunning = TRUE;
+    simMspfgNextNs = simNs + SIM_MSPFG_PERIOD * SIM_NS_PER_MS;
+    return;
+  }
+  if( simNs < simMspfgNextNs )
+    return;
+
+  simMspfgNextNs += SIM_MSPFG_PERIOD * SIM_NS_PER_MS;
+  if( !testMspfgMeasure( simCapRaw ) )
+    return;
+
+  if( simCritArmed && ( testMspfg.reg[MSPFG_FUEL_LVL] <= testMspfg.reg[MSPFG_FUEL_LVL_CRIT_THRESH] ) )
+  {
+    simCritArmed = FALSE;
+    simCritEdgeNs = simNs;
+    simCritEdgePass = simPasses;
+    simCritBulkPass = 0;
+    simCritEdgeHost = simHostSeconds();
+    simCritCompeting = simTimerExpire( SIM_TASK_MAIN, MAIN_ASYNCBULK_EVT );
+  }
+
+} // simMspfgTick
+
+// Steps the parts to the current time and drives their interrupt lines
+static void simDevices( void )
+{
+  simMspfgTick();
+
+  if( ( simMma.reg[MMA_REG_CTRL_REG1] & MMA_CTRL_REG1_ACTIVE ) && ( simNs >= simMma.nextNs ) )
+  {
+    simMmaDrdy();
+    simMma.nextNs += simMmaPeriodNs();
+  }
+
+  uint8 levels[3] = { 0xFF, 0xFF, 0xFF };
+  if( testMspfg.intAsserted )
+    simPinLow( levels, PINID_MSP_INT );
+  if( simMmaInt( TRUE ) )
+    simPinLow( levels, PINID_ACCEL_INT1 );
+  if( simMmaInt( FALSE ) )
+    simPinLow( levels, PINID_ACCEL_INT2 );
+  simDrivePorts( levels );
+
+} // simDevices
+
+static uint64_t simNextEventNs( uint64_t endNs )
+{
+  uint64_t next = endNs;
+
+  for( uint8 i = 0; i < SIM_MAX_TIMERS; i++ )
+  {
+    if( simTimers[i].used && ( simTimers[i].expNs < next ) )
+      next = simTimers[i].expNs;
+  }
+  if( simMspfgRunning && ( simMspfgNextNs < next ) )
+    next = simMspfgNextNs;
+  if( ( simMma.reg[MMA_REG_CTRL_REG1] & MMA_CTRL_REG1_ACTIVE ) && ( simMma.nextNs < next ) )
+    next = simMma.nextNs;
+  return next;
+
+} // simNextEventNs
+
+// Runs the board for "ms": parts, then expired timers, then one scheduler
+// pass; the clock jumps to the next timer or part event when all is idle
+static void simRun( uint32 ms )
+{
+  uint64_t endNs = simNs + ms * SIM_NS_PER_MS;
+
+  for( ;; )
+  {
+    simDevices();
+
+    for( uint8 i = 0; i < SIM_MAX_TIMERS; i++ )
+    {
+      if( simTimers[i].used && ( simTimers[i].expNs <= simNs ) )
+      {
+        simTimers[i].used = FALSE;
+        simEvents[simTimers[i].taskId] |= simTimers[i].event;
+      }
+    }
+
+    if( simPass() )
+      continue;
+    if( simNs >= endNs )
+      break;
+
+    uint64_t next = simNextEventNs( endNs );
+    simSetNs( ( next > simNs ) ? next : simNs + 1 );
+  }
+
+} // simRun
+
+// Central writes a command, with its Mailbox argument, to the Generic profile
+// and waits out the response delay. Returns the response code, 0 if none.
+static uint16 simCommand( uint16 cmd, const uint8 *pArg, uint8 len )
+{
+  uint8 from = simRspNum;
+
+  memset( simMailbox, 0, sizeof( simMailbox ) );
+  memcpy( simMailbox, pArg, len );
+  simCmd = cmd;
+  if( simGenCBs != NULL )
+    simGenCBs->pfnSimpleProfileChange( MUJOEGENERICPROFILE_COMMAND );
+  simRun( 2 * MUJOE_DEFAULT_RSPDELAY );
+
+  return ( simRspNum > from ) ? simRsp[from].code : 0;
+
+} // simCommand
+
+// Index of the first Response write of "code" from "from" on, -1 if none
+static int simFindRsp( uint16 code, uint8 from )
+{
+  for( uint8 i = from; i < simRspNum; i++ )
+  {
+    if( simRsp[i].code == code )
+      return i;
+  }
+  return -1;
+
+} // simFindRsp
+
+////////////////////////////////////////////////////////////////////////////////
+// TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+// Powers the board up, lets the sensors come up under the ground profile, then
+// selects flight and starts Async Bulk as the app does
+static void testBoot( void )
+{
+  testMspfgReset();
+  testMspfg.reg[MSPFG_CAP_FULL_LSB] = (uint8)SIM_MSPFG_CAP_FULL;
+  testMspfg.reg[MSPFG_CAP_FULL_MSB] = (uint8)( SIM_MSPFG_CAP_FULL >> 8 );
+  simCapRaw = SIM_MSPFG_CAP_FULL * 60 / 100;
+  simBaroReset();
+  simMmaReset();
+  simEepromReset();
+  P0 = P1 = P2 = 0xFF;
+  simSetNs( 0 );
+
+  mainTask_Init( SIM_TASK_MAIN );
+  sensorMgrTask_Init( SIM_TASK_SENSORMGR );
+  simRun( 1000 );
+
+  CHECK( mujoeOpProfile_getActive() == OPPROFILE_GROUND, "profile %u after boot", mujoeOpProfile_getActive() );
+  CHECK( simGenCBs != NULL, "no profile callbacks" );
+  CHECK( testMspfg.cont, "gauge not streaming" );
+  CHECK( testMspfg.reg[MSPFG_FUEL_LVL_CRIT_THRESH] == SENSORMGR_FUEL_CRIT_THRESH, "gauge threshold %u",
+         testMspfg.reg[MSPFG_FUEL_LVL_CRIT_THRESH] );
+
+  uint8 sel = OPPROFILE_FLIGHT;
+  uint16 rsp = simCommand( BUILD_UINT16( MUJOE_GRP_SYS_ID_OPPROFILE, MUJOE_CMD_GRP_SYS ), &sel, 1 );
+  CHECK( rsp == MUJOE_RSP_SUCCESS, "select flight 0x%04X", rsp );
+  uint8 period[4] = { 0, 0, HI_UINT16( SIM_ASYNCBULK_PERIOD ), LO_UINT16( SIM_ASYNCBULK_PERIOD ) };
+  rsp = simCommand( BUILD_UINT16( MUJOE_GRP_DAT_ID_STASYNCBULK, MUJOE_CMD_GRP_DAT ), period, sizeof( period ) );
+  CHECK( rsp == MUJOE_RSP_SUCCESS, "start Async Bulk 0x%04X", rsp );
+  simRun( 3000 );
+
+  CHECK( mujoeOpProfile_getActive() == OPPROFILE_FLIGHT, "profile %u after select", mujoeOpProfile_getActive() );
+  CHECK( sensorMgrTask_getHealth() == 0, "health 0x%04X", sensorMgrTask_getHealth() );
+  CHECK( brdSensorDat.ppgfg.fuelSnap.fuelLvl == 60, "fuel level %u", brdSensorDat.ppgfg.fuelSnap.fuelLvl );
+  CHECK( brdSensorDat.ppgfg.barPressure > 0, "no pressure" );
+  CHECK( simAsyncBulkNum > 0, "no Async Bulk packets" );
+
+} // testBoot
+
+// Drains the tank past the threshold and times the alarm from the MSP_INT edge
+// of the measurement that crosses it to the write into the Response
+// characteristic's notification buffer. The Async Bulk event is pending on the
+// same tick and runs first, it is ahead of the GPIO manager in mainTask.
+static void testCritLatency( void )
+{
+  uint8 from = simRspNum;
+
+  simCritArmed = TRUE;
+  simCapRaw = SIM_MSPFG_CAP_FULL * 10 / 100;
+  simRun( 5000 );
+
+  int idx = simFindRsp( MUJOE_NOTI_FUEL_CRIT, from );
+  CHECK( !simCritArmed && ( idx >= 0 ), "no alarm, edge %s", simCritArmed ? "not seen" : "seen" );
+  if( simCritArmed || ( idx < 0 ) )
+    return;
+
+  simRsp_t *pRsp = &simRsp[idx];
+  uint32 passes = pRsp->pass - simCritEdgePass + 1;
+  double busUs = ( pRsp->ns - simCritEdgeNs ) / 1e3;
+
+  CHECK( brdSensorDat.ppgfg.fuelCrit, "alarm state not set" );
+  CHECK( simCritCompeting && ( simCritBulkPass >= simCritEdgePass ) && ( simCritBulkPass < pRsp->pass ),
+         "Async Bulk did not run between edge and alarm" );
+
+  // Competing event, GPIO manager (snapshot read and compare), alarm event
+  CHECK( passes <= 3, "alarm took %u passes", passes );
+  CHECK( busUs < 1000, "alarm took %.1f us", busUs );
+
+  printf( "  crit alarm, edge to notification %6.1f us on the bus, %u passes with Async Bulk ahead, %.1f us host\n",
+          busUs, passes, ( pRsp->host - simCritEdgeHost ) * 1e6 );
+
+  // Refill clears it
+  from = simRspNum;
+  simCapRaw = SIM_MSPFG_CAP_FULL * 60 / 100;
+  simRun( 5000 );
+  CHECK( simFindRsp( MUJOE_NOTI_FUEL_CRIT_CLR, from ) >= 0, "alarm not cleared" );
+  CHECK( !brdSensorDat.ppgfg.fuelCrit, "alarm state still set" );
+
+} // testCritLatency
+
+// Stationary in flight, the accel auto-sleeps: the gauge is put to sleep with
+// MSP_INT masked and left alone, no fault is raised. The first motion resumes
+// it and a fresh measurement is read within a gauge period.
+static void testStationary( void )
+{
+  uint8 mspInt = 0x01 << gpioPinTable[PINID_MSP_INT].pin;
+
+  simAccelSleep();
+  simRun( 100 );
+  CHECK( MMA8453QMgr_isSleeping(), "accel not asleep" );
+  CHECK( !testMspfg.cont, "gauge still streaming" );
+  CHECK( !( P0IEN & mspInt ), "MSP_INT still enabled" );
+
+  uint32 writes = testMspfg.numWrites;
+  uint32 reads = testMspfg.numReads;
+  simRun( 10000 );
+  CHECK( ( testMspfg.numWrites == writes ) && ( testMspfg.numReads == reads ),
+         "gauge accessed while stationary, %u writes %u reads",
+         testMspfg.numWrites - writes, testMspfg.numReads - reads );
+  CHECK( sensorMgrTask_getHealth() == 0, "health 0x%04X while stationary", sensorMgrTask_getHealth() );
+
+  uint64_t motionNs = simNs;
+  simAccelMotion();
+  simRun( 1 );
+  CHECK( !MMA8453QMgr_isSleeping(), "accel still asleep" );
+  CHECK( testMspfg.cont, "gauge not restarted" );
+  CHECK( P0IEN & mspInt, "MSP_INT not enabled" );
+
+  // The resumed gauge's first measurement is read off its MSP_INT edge
+  uint32 resumeTs = brdSensorDat.ppgfg.fuelTimestamp;
+  while( ( brdSensorDat.ppgfg.fuelTimestamp == resumeTs ) && ( simNs - motionNs < 2 * SENSORMGR_FUEL_PERIOD * SIM_NS_PER_MS ) )
+    simRun( 1 );
+  uint32 resumeMs = (uint32)( ( simNs - motionNs ) / SIM_NS_PER_MS );
+  CHECK( resumeMs <= SENSORMGR_FUEL_PERIOD + 10, "first measurement %u ms after motion", resumeMs );
+
+  simRun( 3000 );
+  CHECK( sensorMgrTask_getHealth() == 0, "health 0x%04X after wake", sensorMgrTask_getHealth() );
+  CHECK( brdSensorDat.ppgfg.fuelSnap.fuelLvl == testMspfg.reg[MSPFG_FUEL_LVL], "fuel level %u, gauge %u",
+         brdSensorDat.ppgfg.fuelSnap.fuelLvl, testMspfg.reg[MSPFG_FUEL_LVL] );
+
+  printf( "  stationary, gauge silent for 10 s, first measurement %u ms after motion\n", resumeMs );
+
+} // testStationary
+
+////////////////////////////////////////////////////////////////////////////////
+// MAIN
+////////////////////////////////////////////////////////////////////////////////
+
+int main( void )
+{
+  testBoot();
+  testCritLatency();
+  testStationary();
+
+  printf( "%d checks, %d failed\n", testNum, testFail );
+  return ( testFail == 0 ) ? 0 : 1;
+
+} // main
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: OSAL.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the OSAL kernel. Events, timers and messages are served by
+// the event loop of the firmware simulation, see simTest.c.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OSAL_H
+#define OSAL_H
+
+#include "bcomdef.h"
+#include "OSAL_Memory.h"
+#include "OSAL_Timers.h"
+
+#define SYS_EVENT_MSG                           0x8000
+#define INVALID_TASK_ID                         0xFF
+
+typedef struct
+{
+  uint8         event;
+  uint8         status;
+
+}osal_event_hdr_t;
+
+uint8 osal_set_event( uint8 task_id, uint16 event_flag );
+uint8 *osal_msg_allocate( uint16 len );
+uint8 osal_msg_deallocate( uint8 *msg_ptr );
+uint8 osal_msg_send( uint8 destination_task, uint8 *msg_ptr );
+uint8 *osal_msg_receive( uint8 task_id );
+
+#endif // OSAL_H
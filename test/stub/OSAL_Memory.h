@@ -0,0 +1,16 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: OSAL_Memory.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the OSAL heap, backed by malloc in the test.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OSAL_MEMORY_H
+#define OSAL_MEMORY_H
+
+#include "hal_types.h"
+
+void *osal_mem_alloc( uint16 size );
+void osal_mem_free( void *ptr );
+
+#endif // OSAL_MEMORY_H
@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: OSAL_PwrMgr.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, the simulation does not model power saving.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OSAL_PWRMGR_H
+#define OSAL_PWRMGR_H
+
+#endif // OSAL_PWRMGR_H
@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: OSAL_Timers.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the OSAL timers, on the simulation clock.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OSAL_TIMERS_H
+#define OSAL_TIMERS_H
+
+#include "hal_types.h"
+
+uint8 osal_start_timerEx( uint8 task_id, uint16 event_id, uint32 timeout_value );
+uint8 osal_stop_timerEx( uint8 task_id, uint16 event_id );
+uint32 osal_GetSystemClock( void );
+
+#endif // OSAL_TIMERS_H
@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: OnBoard.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, nothing of the board support package is used.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ONBOARD_H
+#define ONBOARD_H
+
+#endif // ONBOARD_H
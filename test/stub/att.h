@@ -0,0 +1,15 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: att.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the ATT definitions the profiles use.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ATT_H
+#define ATT_H
+
+#include "bcomdef.h"
+
+#define ATT_BT_UUID_SIZE                        2
+
+#endif // ATT_H
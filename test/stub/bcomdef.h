@@ -0,0 +1,23 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: bcomdef.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the BLE stack common definitions.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BCOMDEF_H
+#define BCOMDEF_H
+
+#include "hal_types.h"
+#include "hal_defs.h"
+
+typedef uint8 bStatus_t;
+
+#define SUCCESS                                 0x00
+#define FAILURE                                 0x01
+#define INVALIDPARAMETER                        0x02
+#define bleAlreadyInRequestedMode               0x11
+#define bleMemAllocError                        0x13
+#define bleInvalidRange                         0x18
+
+#endif // BCOMDEF_H
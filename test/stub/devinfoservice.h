@@ -0,0 +1,19 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: devinfoservice.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the device information service.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DEVINFOSERVICE_H
+#define DEVINFOSERVICE_H
+
+#include "bcomdef.h"
+
+#define DEVINFO_SYSTEM_ID                       0
+#define DEVINFO_SYSTEM_ID_LEN                   8
+
+bStatus_t DevInfo_AddService( void );
+bStatus_t DevInfo_SetParameter( uint8 param, uint8 len, void *value );
+
+#endif // DEVINFOSERVICE_H
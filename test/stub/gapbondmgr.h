@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: gapbondmgr.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the GAP bond manager.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAPBONDMGR_H
+#define GAPBONDMGR_H
+
+#include "bcomdef.h"
+
+#define GAPBOND_PAIRING_MODE                    0x400
+#define GAPBOND_MITM_PROTECTION                 0x402
+#define GAPBOND_IO_CAPABILITIES                 0x403
+#define GAPBOND_BONDING_ENABLED                 0x406
+#define GAPBOND_DEFAULT_PASSCODE                0x408
+#define GAPBOND_PAIRING_MODE_WAIT_FOR_REQ       0x01
+#define GAPBOND_IO_CAP_DISPLAY_ONLY             0x00
+
+typedef struct
+{
+  void          *passcodeCB;
+  void          *pairStateCB;
+
+}gapBondCBs_t;
+
+bStatus_t GAPBondMgr_SetParameter( uint16 param, uint8 len, void *pValue );
+bStatus_t GAPBondMgr_Register( gapBondCBs_t *pCB );
+
+#endif // GAPBONDMGR_H
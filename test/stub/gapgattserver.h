@@ -0,0 +1,19 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: gapgattserver.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the GAP GATT server.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GAPGATTSERVER_H
+#define GAPGATTSERVER_H
+
+#include "bcomdef.h"
+
+#define GAP_DEVICE_NAME_LEN                     21
+#define GGS_DEVICE_NAME_ATT                     0
+
+bStatus_t GGS_SetParameter( uint8 param, uint8 len, void *value );
+bStatus_t GGS_AddService( uint32 services );
+
+#endif // GAPGATTSERVER_H
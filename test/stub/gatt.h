@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: gatt.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the GATT definitions the tasks use.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GATT_H
+#define GATT_H
+
+#include "bcomdef.h"
+#include "OSAL.h"
+#include "att.h"
+
+#define GATT_MSG_EVENT                          0xB0
+#define GATT_ALL_SERVICES                       0xFFFFFFFF
+
+// Attribute protocol PDU, opaque to the tasks
+typedef struct
+{
+  uint8         len;
+  uint8         *pValue;
+
+}gattMsg_t;
+
+typedef struct
+{
+  osal_event_hdr_t      hdr;
+  uint16                connHandle;
+  uint8                 method;
+  gattMsg_t             msg;
+
+}gattMsgEvent_t;
+
+void GATT_bm_free( gattMsg_t *pMsg, uint8 opcode );
+
+#endif // GATT_H
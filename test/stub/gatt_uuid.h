@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: gatt_uuid.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, the profiles' attribute tables are not built.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GATT_UUID_H
+#define GATT_UUID_H
+
+#endif // GATT_UUID_H
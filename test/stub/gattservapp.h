@@ -0,0 +1,15 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: gattservapp.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the GATT server application.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GATTSERVAPP_H
+#define GATTSERVAPP_H
+
+#include "gatt.h"
+
+bStatus_t GATTServApp_AddService( uint32 services );
+
+#endif // GATTSERVAPP_H
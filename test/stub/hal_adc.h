@@ -0,0 +1,28 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_adc.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the HAL ADC channel numbers.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_ADC_H
+#define HAL_ADC_H
+
+#define HAL_ADC_CHN_AIN0                        0x00
+#define HAL_ADC_CHN_AIN1                        0x01
+#define HAL_ADC_CHN_AIN2                        0x02
+#define HAL_ADC_CHN_AIN3                        0x03
+#define HAL_ADC_CHN_AIN4                        0x04
+#define HAL_ADC_CHN_AIN5                        0x05
+#define HAL_ADC_CHN_AIN6                        0x06
+#define HAL_ADC_CHN_AIN7                        0x07
+#define HAL_ADC_CHN_A0A1                        0x08
+#define HAL_ADC_CHN_A2A3                        0x09
+#define HAL_ADC_CHN_A4A5                        0x0a
+#define HAL_ADC_CHN_A6A7                        0x0b
+#define HAL_ADC_CHN_GND                         0x0c
+#define HAL_ADC_CHN_VREF                        0x0d
+#define HAL_ADC_CHN_TEMP                        0x0e
+#define HAL_ADC_CHN_VDD3                        0x0f
+
+#endif // HAL_ADC_H
@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_defs.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the TI HAL byte helpers.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_DEFS_H
+#define HAL_DEFS_H
+
+#include "hal_types.h"
+
+#define HI_UINT16( a )                          ( ( ( a ) >> 8 ) & 0xFF )
+#define LO_UINT16( a )                          ( ( a ) & 0xFF )
+#define BUILD_UINT16( loByte, hiByte )          ( (uint16)( ( ( loByte ) & 0x00FF ) + ( ( ( hiByte ) & 0x00FF ) << 8 ) ) )
+
+#endif // HAL_DEFS_H
@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_key.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, nothing of the key driver is used.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_KEY_H
+#define HAL_KEY_H
+
+#endif // HAL_KEY_H
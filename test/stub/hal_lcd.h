@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_lcd.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, nothing of the LCD driver is used.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_LCD_H
+#define HAL_LCD_H
+
+#endif // HAL_LCD_H
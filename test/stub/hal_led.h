@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_led.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, nothing of the LED driver is used.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_LED_H
+#define HAL_LED_H
+
+#endif // HAL_LED_H
@@ -0,0 +1,28 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_mcu.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the CC2541 HAL: the SFRs are plain variables the tests
+// drive, the XDATA mapped SFRs an array indexed by the low address byte, an
+// ISR is a plain function the test calls, critical sections are no-ops.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_MCU_H
+#define HAL_MCU_H
+
+#include "hal_types.h"
+#include "iocc2541.h"
+
+typedef uint8 halIntState_t;
+
+#undef SFRIO
+#define SFRIO( x )                              ( XSFR[( x ) & 0xFF] )
+
+#define HAL_ENTER_CRITICAL_SECTION( x )         ( ( x ) = 0 )
+#define HAL_EXIT_CRITICAL_SECTION( x )          ( (void)( x ) )
+
+#define HAL_ISR_FUNCTION( f, v )                void f( void )
+#define HAL_ENTER_ISR()
+#define HAL_EXIT_ISR()
+
+#endif // HAL_MCU_H
@@ -0,0 +1,33 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hal_types.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the TI HAL types so the platform independent kernels build
+// with a desktop compiler. The fixed width types match the IAR 8051 target but
+// int does not: it is 16 bits on the target and 32 bits here. An expression
+// that overflows through integer promotion on the target, e.g. a uint16
+// product or an int16 shifted left, is computed in 32 bits on the host and
+// passes these checks. Intermediates wider than 16 bits need explicit int32 or
+// uint32 casts in the source, the host build cannot catch a missing one.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HAL_TYPES_H
+#define HAL_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int8_t          int8;
+typedef uint8_t         uint8;
+typedef int16_t         int16;
+typedef uint16_t        uint16;
+typedef int32_t         int32;
+typedef uint32_t        uint32;
+typedef uint8           bool;
+
+#define TRUE            1
+#define FALSE           0
+#define VOID            (void)
+#define BV( n )         ( 1 << ( n ) )
+
+#endif // HAL_TYPES_H
@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: hci.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the HCI vendor specific commands.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HCI_H
+#define HCI_H
+
+#include "bcomdef.h"
+
+#define HCI_EXT_ENABLE_CLK_DIVIDE_ON_HALT       1
+
+bStatus_t HCI_EXT_ClkDivOnHaltCmd( uint8 control );
+
+#endif // HCI_H
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: iocc2541.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the CC2541 SFRs: plain variables the tests drive. The I2C
+// driver is replaced by the test's own bus stubs.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IOCC2541_H
+#define IOCC2541_H
+
+#include "hal_types.h"
+
+// Interrupt vectors, HAL_ISR_FUNCTION ignores them on the host
+#define P0INT_VECTOR                            0x6B
+#define P1INT_VECTOR                            0x7B
+#define ST_VECTOR                               0x2B
+
+// Sleep timer
+extern volatile uint8 ST0, ST1, ST2;
+
+// Ports, their interrupt masks and flags, and the interrupt enables
+extern volatile uint8 P0, P1, P2;
+extern volatile uint8 P0IEN, P1IEN, P2IEN;
+extern volatile uint8 P0INP, P1INP, P2INP;
+extern volatile uint8 P0IF, P1IF, P2IF;
+extern volatile uint8 PICTL, IEN0, IEN1, IEN2;
+
+// The PxIFG flags are R/W0 on the part: writing 0 clears a flag, writing 1
+// leaves it as is. Every access goes through hostPortIfg, which folds the
+// previous access's write into the flags first.
+volatile uint8 *hostPortIfg( uint8 port );
+
+#define P0IFG                                   ( *hostPortIfg( 0 ) )
+#define P1IFG                                   ( *hostPortIfg( 1 ) )
+#define P2IFG                                   ( *hostPortIfg( 2 ) )
+
+// XDATA mapped SFRs (PxDIR and friends), see SFRIO in hal_mcu.h
+extern volatile uint8 XSFR[256];
+
+#endif // IOCC2541_H
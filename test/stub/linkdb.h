@@ -0,0 +1,11 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: linkdb.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, nothing of the link database is used.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LINKDB_H
+#define LINKDB_H
+
+#endif // LINKDB_H
@@ -0,0 +1,14 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: muJoeBoardSpecificDrivers.h
+// @author: Joseph Corteo Jr.
+//
+// The IAR project's file system is case insensitive, the sources include
+// mujoeBoardSpecificDrivers.h by this name.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEBOARDSPECIFICDRIVERS_FWD_H
+#define MUJOEBOARDSPECIFICDRIVERS_FWD_H
+
+#include "mujoeBoardSpecificDrivers.h"
+
+#endif // MUJOEBOARDSPECIFICDRIVERS_FWD_H
@@ -0,0 +1,14 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: muJoeGPIO.h
+// @author: Joseph Corteo Jr.
+//
+// The IAR project's file system is case insensitive, the sources include
+// mujoeGPIO.h by this name.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEGPIO_FWD_H
+#define MUJOEGPIO_FWD_H
+
+#include "mujoeGPIO.h"
+
+#endif // MUJOEGPIO_FWD_H
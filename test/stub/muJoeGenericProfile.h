@@ -0,0 +1,14 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: muJoeGenericProfile.h
+// @author: Joseph Corteo Jr.
+//
+// The IAR project's file system is case insensitive, the sources include
+// mujoeGenericProfile.h by this name.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEGENERICPROFILE_FWD_H
+#define MUJOEGENERICPROFILE_FWD_H
+
+#include "mujoeGenericProfile.h"
+
+#endif // MUJOEGENERICPROFILE_FWD_H
@@ -0,0 +1,14 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: muJoeGenericProfileMgr.h
+// @author: Joseph Corteo Jr.
+//
+// The IAR project's file system is case insensitive, the sources include
+// mujoeGenericProfileMgr.h by this name.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MUJOEGENERICPROFILEMGR_FWD_H
+#define MUJOEGENERICPROFILEMGR_FWD_H
+
+#include "mujoeGenericProfileMgr.h"
+
+#endif // MUJOEGENERICPROFILEMGR_FWD_H
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: peripheral.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in for the GAP peripheral role.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PERIPHERAL_H
+#define PERIPHERAL_H
+
+#include "bcomdef.h"
+
+#define GAPROLE_BD_ADDR                         0x304
+#define GAPROLE_ADVERT_ENABLED                  0x305
+#define GAPROLE_ADVERT_OFF_TIME                 0x306
+#define GAPROLE_ADVERT_DATA                     0x307
+#define GAPROLE_SCAN_RSP_DATA                   0x308
+#define GAPROLE_PARAM_UPDATE_ENABLE             0x30B
+#define GAPROLE_MIN_CONN_INTERVAL               0x30C
+#define GAPROLE_MAX_CONN_INTERVAL               0x30D
+#define GAPROLE_SLAVE_LATENCY                   0x30E
+#define GAPROLE_TIMEOUT_MULTIPLIER              0x30F
+#define GAPROLE_NO_ACTION                       0
+
+#define GAP_ADTYPE_FLAGS                        0x01
+#define GAP_ADTYPE_16BIT_MORE                   0x02
+#define GAP_ADTYPE_LOCAL_NAME_COMPLETE          0x09
+#define GAP_ADTYPE_POWER_LEVEL                  0x0A
+#define GAP_ADTYPE_SLAVE_CONN_INTERVAL_RANGE    0x12
+#define GAP_ADTYPE_FLAGS_GENERAL                0x02
+#define GAP_ADTYPE_FLAGS_BREDR_NOT_SUPPORTED    0x04
+
+#define TGAP_GEN_DISC_ADV_INT_MIN               2
+#define TGAP_GEN_DISC_ADV_INT_MAX               3
+#define TGAP_LIM_DISC_ADV_INT_MIN               4
+#define TGAP_LIM_DISC_ADV_INT_MAX               5
+#define TGAP_CONN_PAUSE_PERIPHERAL              22
+
+#define B_ADDR_LEN                              6
+
+typedef enum
+{
+  GAPROLE_INIT = 0,
+  GAPROLE_STARTED,
+  GAPROLE_ADVERTISING,
+  GAPROLE_WAITING,
+  GAPROLE_WAITING_AFTER_TIMEOUT,
+  GAPROLE_CONNECTED,
+  GAPROLE_CONNECTED_ADV,
+  GAPROLE_ERROR,
+
+}gaprole_States_t;
+
+typedef struct
+{
+  void          (*pfnStateChange)( gaprole_States_t newState );
+  void          *pfnRssiRead;
+
+}gapRolesCBs_t;
+
+bStatus_t GAPRole_SetParameter( uint16 param, uint8 len, void *pValue );
+bStatus_t GAPRole_GetParameter( uint16 param, void *pValue );
+bStatus_t GAPRole_StartDevice( gapRolesCBs_t *pAppCallbacks );
+bStatus_t GAPRole_SendUpdateParam( uint16 minConnInterval, uint16 maxConnInterval,
+                                   uint16 latency, uint16 connTimeout, uint8 handleFailure );
+bStatus_t GAP_SetParamValue( uint16 paramID, uint16 paramValue );
+
+#endif // PERIPHERAL_H
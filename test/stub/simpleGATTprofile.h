@@ -0,0 +1,13 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: simpleGATTprofile.h
+// @author: Joseph Corteo Jr.
+//
+// Host stand-in, only the service UUID is advertised.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIMPLEGATTPROFILE_H
+#define SIMPLEGATTPROFILE_H
+
+#define SIMPLEPROFILE_SERV_UUID                 0xFFF0
+
+#endif // SIMPLEGATTPROFILE_H
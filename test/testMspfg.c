@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: testMspfg.c
+// @author: Joseph Corteo Jr.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "testMspfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// GLOBAL VAR
+////////////////////////////////////////////////////////////////////////////////
+
+testMspfg_t                     testMspfg;
+
+////////////////////////////////////////////////////////////////////////////////
+// MODEL
+////////////////////////////////////////////////////////////////////////////////
+
+void testMspfgReset( void )
+{
+  memset( &testMspfg, 0, sizeof( testMspfg ) );
+  testMspfg.reg[MSPFG_WHO_AM_I] = TEST_MSPFG_WHO_AM_I;
+  testMspfg.present = TRUE;
+
+} // testMspfgReset
+
+// Bit times of one transaction: start, address and data bytes with their
+// acknowledges, stop or repeated start
+uint32 testI2cBits( uint8 len )
+{
+  return 9 * ( 1 + (uint32)len ) + 2;
+
+} // testI2cBits
+
+uint8 testMspfgWrite( uint8 len, uint8 *pBuf )
+{
+  if( !testMspfg.present || ( len == 0 ) )
+    return 0;
+
+  testMspfg.numWrites++;
+  testMspfg.busBits += testI2cBits( len );
+
+  switch( pBuf[0] )
+  {
+  case MSPFG_CMD_ST_CONT_DATA:
+    testMspfg.cont = TRUE;
+    return len;
+  case MSPFG_CMD_SP_CONT_DATA:
+  case MSPFG_CMD_SLEEP:
+    testMspfg.cont = FALSE;
+    return len;
+  case MSPFG_CMD_SINGLESHOT_DATA:
+    testMspfg.single = TRUE;
+    return len;
+  default:
+    break;
+  }
+
+  if( pBuf[0] > MSPFG_FUEL_LVL )
+    return 0;
+
+  testMspfg.ptr = pBuf[0];
+  for( uint8 i = 1; i < len; i++ )
+  {
+    uint8 r = testMspfg.ptr++;
+    if( r > MSPFG_FUEL_LVL )
+      return i;
+    if( ( r == MSPFG_CFG ) || ( r == MSPFG_CAP_FULL_LSB ) || ( r == MSPFG_CAP_FULL_MSB ) ||
+        ( r == MSPFG_FUEL_LVL_CRIT_THRESH ) )
+      testMspfg.reg[r] = pBuf[i];
+  }
+  return len;
+
+} // testMspfgWrite
+
+uint8 testMspfgRead( uint8 len, uint8 *pBuf )
+{
+  if( !testMspfg.present )
+    return 0;
+
+  testMspfg.numReads++;
+  testMspfg.busBits += testI2cBits( len );
+  testMspfg.intAsserted = FALSE;
+
+  uint8 i;
+  for( i = 0; ( i < len ) && ( testMspfg.ptr <= MSPFG_FUEL_LVL ); i++ )
+    pBuf[i] = testMspfg.reg[testMspfg.ptr++];
+  return i;
+
+} // testMspfgRead
+
+// Takes a measurement of "capRaw" if the gauge is collecting. The tracking
+// capacitance follows the raw one with a 1/2 step and the level is mapped
+// linearly onto CAP_FULL. Asserts MSP_INT, returns FALSE if nothing was taken.
+bool testMspfgMeasure( uint16 capRaw )
+{
+  if( !testMspfg.cont && !testMspfg.single )
+    return FALSE;
+  testMspfg.single = FALSE;
+
+  uint16 capFull = ( (uint16)testMspfg.reg[MSPFG_CAP_FULL_MSB] << 8 ) + testMspfg.reg[MSPFG_CAP_FULL_LSB];
+  uint16 capAlgo = ( (uint16)testMspfg.reg[MSPFG_CAP_ALGO_MSB] << 8 ) + testMspfg.reg[MSPFG_CAP_ALGO_LSB];
+  capAlgo = ( capAlgo == 0 ) ? capRaw : (uint16)( capAlgo + ( (int32)capRaw - capAlgo ) / 2 );
+
+  uint32 lvl = ( capFull == 0 ) ? 0 : (uint32)capAlgo * MSPFG_FUEL_LVL_MAX / capFull;
+
+  testMspfg.reg[MSPFG_CAP_ALGO_LSB] = (uint8)capAlgo;
+  testMspfg.reg[MSPFG_CAP_ALGO_MSB] = (uint8)( capAlgo >> 8 );
+  testMspfg.reg[MSPFG_CAP_RAW_LSB] = (uint8)capRaw;
+  testMspfg.reg[MSPFG_CAP_RAW_MSB] = (uint8)( capRaw >> 8 );
+  testMspfg.reg[MSPFG_FUEL_LVL] = (uint8)( ( lvl > MSPFG_FUEL_LVL_MAX ) ? MSPFG_FUEL_LVL_MAX : lvl );
+  testMspfg.intAsserted = TRUE;
+  return TRUE;
+
+} // testMspfgMeasure
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+// @filename: testMspfg.h
+// @author: Joseph Corteo Jr.
+//
+// Register model of the MSP fuel gauge, shared by hostTest and simTest.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TESTMSPFG_H
+#define TESTMSPFG_H
+
+////////////////////////////////////////////////////////////////////////////////
+// INCLUDE
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hal_types.h"
+#include "MSPFuelGauge.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DEFINES
+////////////////////////////////////////////////////////////////////////////////
+
+// Gauge identity, and the I2C clock the board runs the bus at (Hz)
+#define TEST_MSPFG_WHO_AM_I             0x5A
+#define TEST_I2C_CLOCK                  267000
+
+////////////////////////////////////////////////////////////////////////////////
+// TYPEDEFS
+////////////////////////////////////////////////////////////////////////////////
+
+// The register pointer auto increments over bursts, writes to the read only
+// registers are acknowledged and dropped, and a measurement is only taken in
+// continuous mode or after a single shot command.
+typedef struct testMspfg_def
+{
+  uint8         reg[MSPFG_FUEL_LVL + 1];
+  uint8         ptr;                    // Register pointer
+  bool          present;                // Acknowledges its address
+  bool          cont;                   // Continuous data collection
+  bool          single;                 // Single shot pending
+  bool          intAsserted;            // MSP_INT, held until a read
+  uint16        numWrites;              // Transactions since reset
+  uint16        numReads;
+  uint32        busBits;                // Bus bit times since reset
+
+}testMspfg_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// EXTERN VARS
+////////////////////////////////////////////////////////////////////////////////
+
+extern testMspfg_t              testMspfg;
+
+////////////////////////////////////////////////////////////////////////////////
+// FUNCTION PROTOS
+////////////////////////////////////////////////////////////////////////////////
+
+void testMspfgReset( void );
+uint32 testI2cBits( uint8 len );
+uint8 testMspfgWrite( uint8 len, uint8 *pBuf );
+uint8 testMspfgRead( uint8 len, uint8 *pBuf );
+bool testMspfgMeasure( uint16 capRaw );
+
+#endif // TESTMSPFG_H